@@ -36,13 +36,70 @@ extern "C"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-ED25519Public::ED25519Public(const unsigned char* publicKey)
+ED25519Public::ED25519Public(const unsigned char* publicKey, bool eager)
+    : m_VerifyCtx(0)
 {
     memcpy(m_Key, publicKey, sizeof(m_Key));
+    if (eager) VerifyContext();
+}
+
+ED25519Public::ED25519Public(const ED25519Public& other)
+    : m_VerifyCtx(0)
+{
+    memcpy(m_Key, other.m_Key, sizeof(m_Key));
+}
+
+ED25519Public::ED25519Public(ED25519Public&& other) noexcept
+    : m_VerifyCtx(other.m_VerifyCtx.exchange(0))
+{
+    memcpy(m_Key, other.m_Key, sizeof(m_Key));
 }
 
 ED25519Public::~ED25519Public()
 {
+    void* ctx = m_VerifyCtx.load();
+    if (ctx) ed25519_Verify_Finish (ctx);
+}
+
+ED25519Public& ED25519Public::operator=(const ED25519Public& other)
+{
+    if (this != &other)
+    {
+        memcpy(m_Key, other.m_Key, sizeof(m_Key));
+        void* ctx = m_VerifyCtx.exchange(0);
+        if (ctx) ed25519_Verify_Finish (ctx);
+    }
+    return *this;
+}
+
+ED25519Public& ED25519Public::operator=(ED25519Public&& other) noexcept
+{
+    if (this != &other)
+    {
+        memcpy(m_Key, other.m_Key, sizeof(m_Key));
+        void* ctx = m_VerifyCtx.exchange(other.m_VerifyCtx.exchange(0));
+        if (ctx) ed25519_Verify_Finish (ctx);
+    }
+    return *this;
+}
+
+// Build the verify context once: the first thread to publish its context
+// wins, the others release theirs. Null if out of memory.
+void* ED25519Public::VerifyContext()
+{
+    void* ctx = m_VerifyCtx.load(std::memory_order_acquire);
+    if (ctx == 0)
+    {
+        void* expected = 0;
+        ctx = ed25519_Verify_Init (0, m_Key);
+        if (ctx && !m_VerifyCtx.compare_exchange_strong(expected, ctx,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            ed25519_Verify_Finish (ctx);
+            ctx = expected;
+        }
+    }
+    return ctx;
 }
 
 const unsigned char* ED25519Public::GetKeyBytes(
@@ -62,9 +119,52 @@ bool ED25519Public::VeifySignature(
     unsigned int msg_size,              /* IN: size of message */
     const unsigned char* signature)     /* IN: [64 bytes] signature (R,S) */
 {
-    return ed25519_VerifySignature (signature, m_Key, msg, msg_size) == 1;
+    void* ctx = VerifyContext();
+    if (ctx == 0)
+        return ed25519_VerifySignature (signature, m_Key, msg, msg_size) == 1;
+
+    return ed25519_Verify_Check (ctx, signature, msg, msg_size) == 1;
 }
 
+bool ED25519Public::VerifyMany(
+    const unsigned char* const* msgs,   /* IN: [count] messages */
+    const size_t* msg_sizes,            /* IN: [count] message sizes */
+    const unsigned char* const* signatures, /* IN: [count] 64-byte signatures */
+    size_t count,                       /* IN: number of messages */
+    int* results)                       /* OUT: [optional] 1/0 per signature */
+{
+    void* ctx = VerifyContext();
+    if (ctx == 0)
+    {
+        bool all = true;
+        for (size_t i = 0; i < count; i++)
+        {
+            int rc = ed25519_VerifySignature (signatures[i], m_Key, msgs[i], msg_sizes[i]);
+            if (results) results[i] = rc;
+            all = all && rc == 1;
+        }
+        return all;
+    }
+
+    return ed25519_Verify_CheckBatch (ctx, count, signatures, msgs, msg_sizes, results) == 1;
+}
+
+#ifdef ED25519_HAVE_SPAN
+bool ED25519Public::VerifyMany(
+    std::span<const unsigned char* const> msgs,
+    std::span<const size_t> msg_sizes,
+    std::span<const unsigned char* const> signatures,
+    std::span<int> results)
+{
+    if (msg_sizes.size() != msgs.size() || signatures.size() != msgs.size() ||
+        (!results.empty() && results.size() != msgs.size()))
+        return false;
+
+    return VerifyMany (msgs.data(), msg_sizes.data(), signatures.data(), msgs.size(),
+        results.empty() ? 0 : results.data());
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Load private key or generate randomly
@@ -87,10 +187,13 @@ ED25519Private::ED25519Private(const unsigned char* key, unsigned int size)
         ed25519_CreateKeyPair (Kpub, m_Key, &edp_genkey_blinding, sk);
         memset (sk, 0, sizeof(sk));
     }
+
+    m_SignCtx = ed25519_Sign_Init (0, m_Key, &edp_signature_blinding);
 }
  
 ED25519Private::~ED25519Private(void)
 {
+    ed25519_Sign_Finish (m_SignCtx);
     memset (m_Key, 0, sizeof(m_Key));
 }
 
@@ -121,5 +224,8 @@ void ED25519Private::SignMessage(
     unsigned int msg_size,      /* IN: size of message */
     unsigned char*signature)    /* OUT: [64 bytes] signature (R,S) */
 {
-    ed25519_SignMessage (signature, m_Key, &edp_signature_blinding, msg, msg_size);
+    if (m_SignCtx)
+        ed25519_Sign_WithCtx (m_SignCtx, signature, msg, msg_size);
+    else
+        ed25519_SignMessage (signature, m_Key, &edp_signature_blinding, msg, msg_size);
 }
@@ -21,17 +21,36 @@
  * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
-#ifndef __ed25519_h__
-#define __ed25519_h__
+#ifndef __ed25519_h__
+#define __ed25519_h__
+
+#include <stddef.h>
+#include <atomic>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#define ED25519_HAVE_SPAN
+#endif
 
 class ED25519Public
 {
 public:
     enum { PublicKeySize = 32, SignatureBytes = 64 };
 
-    ED25519Public(const unsigned char* PublicKey);
+    /*
+     *   The verify context (see ed25519_Verify_Init()) is built on the
+     *   first verification, or here when eager is set, and reused by
+     *   every later call. Concurrent first calls may each build one; a
+     *   single context is kept. Copies share nothing and build their own.
+     */
+    ED25519Public(const unsigned char* PublicKey, bool eager = false);
+    ED25519Public(const ED25519Public& other);
+    ED25519Public(ED25519Public&& other) noexcept;
     ~ED25519Public();
 
+    ED25519Public& operator=(const ED25519Public& other);
+    ED25519Public& operator=(ED25519Public&& other) noexcept;
+
     const unsigned char* GetKeyBytes(unsigned char* publicKey) const;
 
     bool VeifySignature(
@@ -39,8 +58,29 @@ public:
         unsigned int msg_size,              /* IN: size of message */
         const unsigned char* signature);    /* IN: [64 bytes] signature (R,S) */
 
+    /* Verify count messages, see ed25519_Verify_CheckBatch().
+       Returns true if all signatures are valid */
+    bool VerifyMany(
+        const unsigned char* const* msgs,   /* IN: [count] messages */
+        const size_t* msg_sizes,            /* IN: [count] message sizes */
+        const unsigned char* const* signatures, /* IN: [count] 64-byte signatures */
+        size_t count,                       /* IN: number of messages */
+        int* results = 0);                  /* OUT: [optional] 1/0 per signature */
+
+#ifdef ED25519_HAVE_SPAN
+    /* All spans must have the same size, results may be empty */
+    bool VerifyMany(
+        std::span<const unsigned char* const> msgs,
+        std::span<const size_t> msg_sizes,
+        std::span<const unsigned char* const> signatures,
+        std::span<int> results = {});
+#endif
+
 private:
+    void* VerifyContext();
+
     unsigned char m_Key[PublicKeySize];
+    std::atomic<void*> m_VerifyCtx;     /* null or ed25519_Verify_Init() */
 };
 
 class ED25519Private
@@ -73,7 +113,11 @@ public:
         unsigned char* signature);  /* OUT: [64 bytes] signature (R,S) */
 
 private:
+    ED25519Private(const ED25519Private&);
+    ED25519Private& operator=(const ED25519Private&);
+
     unsigned char m_Key[PrivateKeySize];
+    void* m_SignCtx;            /* expanded key, see ed25519_Sign_Init() */
 };
 
 #endif // __ed25519_h__
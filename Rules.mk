@@ -55,6 +55,54 @@ endif
 # Uncomment next line for big-endian target CPUs
 #CFLAGS += -DECP_CONFIG_BIG_ENDIAN
 
+# Fixed-base comb for KeyGen/Sign: number of 8-fold tables (1, 2 or 4).
+# Each table adds 12KB (signed digits); 2 tables need 15 doublings, 4 tables need 7.
+# Extra tables are generated by custom_tool into $(BUILD_DIR)/base_comb.h
+ECP_BASE_TABLES ?= 1
+
+# Base table lookups in KeyGen/Sign scan all entries with a mask (AVX2 when
+# the CPU has it) so the secret slice index does not show in the cache.
+# Set to 0 for direct loads: faster, not constant-time.
+ECP_CT_LOOKUP ?= 1
+
+# Small-footprint profile for memory-constrained targets:
+#   0 = off (fastest)
+#   1 = 4-fold signed base table of 8 entries (768 bytes instead of 12KB),
+#       420-byte verify context (424 x64, 2-fold Q table), smaller
+#       ecp_Inverse frame
+#   2 = as 1, base table is built at first use (.bss instead of .rodata)
+# Needs ECP_BASE_TABLES=1. 'make footprint' reports sizes and stack use.
+ECP_SMALL ?= 0
+
+# POSIX threads: background refill of the offline/online signing pool and
+# spinning helpers of the low-latency mode (ed25519_LowLatency_Start).
+# Set to 0 for a library without threads.
+ECP_THREADS ?= 1
+
+# Thread-local counters of field, scalar, point and SHA-512 block operations
+# (ecp_OpCounts_Snapshot/Reset); the test prints the operation mix of each
+# API. Portable C library only: 'make ECP_COUNT_OPS=1 clean test'
+ECP_COUNT_OPS ?= 0
+
+# USDT probes at entry and return of every public sign, verify and DH
+# function (provider curve25519, e.g. Sign_WithCtx__entry), arguments are
+# the context (or key) and the message size. Needs <sys/sdt.h>
+# (systemtap-sdt-dev); a disabled probe is a nop in the code.
+ECP_TRACE ?= 0
+
+# Lock-free latency histograms of the same functions, scraped with
+# ed25519_Latency_Snapshot(). Costs two clock reads per call.
+ECP_LATENCY ?= 0
+
+ECP_CONFIG = -DECP_BASE_TABLES=$(ECP_BASE_TABLES) -DECP_CT_LOOKUP=$(ECP_CT_LOOKUP) \
+    -DECP_SMALL_FOOTPRINT=$(ECP_SMALL) -DECP_THREADS=$(ECP_THREADS) \
+    -DECP_COUNT_OPS=$(ECP_COUNT_OPS) -DECP_TRACE=$(ECP_TRACE) \
+    -DECP_LATENCY=$(ECP_LATENCY)
+
+ifeq ($(ECP_THREADS),1)
+THREAD_LIBS = -lpthread
+endif
+
 # programs we use
 CC    = gcc
 GPP   = g++
@@ -68,6 +116,7 @@ PATCH = patch
 SHELL = /bin/sh
 INSTALL = install
 NM      = nm
+SIZE    = size
 
 MAKE_STATIC_LIB         = $(AR) cr
 MAKE_SHARED_LIB         = $(GPP) -shared -o
@@ -13,6 +13,7 @@ pushd %TOPDIR%
 
 echo Generating custom blinding
 "%BINPATH%CustomTool.exe" b edp_custom_blinding 1> source\custom_blind.h
+"%BINPATH%CustomTool.exe" f _w_base_folding8 8 1 pa s 1> source\base_folding8.h
 
 "%BINPATH%CustomTool.exe" b edp_genkey_blinding    1>  C++\custom_blinds.h
 "%BINPATH%CustomTool.exe" b edp_signature_blinding 1>> C++\custom_blinds.h
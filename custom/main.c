@@ -140,10 +140,256 @@ int CreateSignTestVector(const char *seed, const char *msg)
     return 1;
 }
 
+/* -- Fixed-base folding tables --------------------------------------------
+//
+//  The 256-bit multiplier is chopped into 'folds' limbs of w = 256/folds 
+//  bits each and P_i = 2^(w*i)*BasePoint (see edp_BasePointMult).
+//  Unsigned digits: entry e = SUM(P_i) for each bit i set in e.
+//  Signed digits:   entry e = P_n + SUM(+/-P_i) for i < n = folds-1, 
+//                   +P_i when bit i of e is set. Half as many entries.
+//  Comb table k holds the same sums for 2^(k*w/tables)*P_i.
+// -------------------------------------------------------------------------
+*/
+static const Ext_POINT _w_BasePoint = {   /* y = 4/5 mod P */
+    W256(0x8F25D51A,0xC9562D60,0x9525A7B2,0x692CC760,0xFDD6DC5C,0xC0A4E231,0xCD6E53FE,0x216936D3),
+    W256(0x66666658,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666),
+    W256(0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000),
+    W256(0xA5B7DDA3,0x6DDE8AB3,0x775152F5,0x20F09F80,0x64ABE37D,0x66EA4E8E,0xD78B7665,0x67875F0F)
+};
+
+extern const U_WORD _w_2d[K_WORDS];
+
+typedef struct {
+    int folds;          /* 4 or 8 */
+    int tables;         /* comb tables: 1, 2 or 4 */
+    int pe;             /* PE_POINT instead of PA_POINT */
+    int sgn;            /* signed digits */
+    int interleave;     /* [entry][table] instead of [table][entry] */
+} FOLD_CONFIG;
+
+static void Ext2Affine(PA_POINT *r, Ext_POINT *p)
+{
+    ecp_Inverse(p->z, p->z);
+    ecp_MulMod(p->x, p->x, p->z);
+    ecp_MulMod(p->y, p->y, p->z);
+    ecp_MulMod(p->t, p->x, p->y);
+    ecp_SetValue(p->z, 1);
+
+    ecp_AddReduce(r->YpX, p->y, p->x); ecp_Mod(r->YpX);
+    ecp_SubReduce(r->YmX, p->y, p->x); ecp_Mod(r->YmX);
+    ecp_MulMod(r->T2d, p->t, _w_2d);
+}
+
+static void NegateAffine(PA_POINT *r, const PA_POINT *p)
+{
+    U_WORD zero[K_WORDS] = { 0 };
+    ecp_Copy(r->YpX, p->YmX);
+    ecp_Copy(r->YmX, p->YpX);
+    ecp_SubReduce(r->T2d, zero, p->T2d); ecp_Mod(r->T2d);
+}
+
+static void PrintFoldEntry(const FOLD_CONFIG *cfg, const PA_POINT *p, 
+    const char *indent, const char *comment, int last)
+{
+    static const U_WORD two[K_WORDS] = { 2 };
+
+    printf("%s{%s\n", indent, comment);
+    printf("%s  ", indent); PrintWords("W256(", p->YpX, K_WORDS);
+    printf("),\n%s  ", indent); PrintWords("W256(", p->YmX, K_WORDS);
+    printf("),\n%s  ", indent); PrintWords("W256(", p->T2d, K_WORDS);
+    if (cfg->pe)
+    {
+        printf("),\n%s  ", indent); PrintWords("W256(", two, K_WORDS);
+    }
+    printf(")\n%s}%s\n", indent, last ? "" : ",");
+}
+
+int CreateFoldingTable(IN const char *name, IN const FOLD_CONFIG *cfg)
+{
+    Ext_POINT B = _w_BasePoint, S;
+    PA_POINT P[8], N, *tbl;
+    const char *type = cfg->pe ? "PE_POINT" : "PA_POINT";
+    char comment[32];
+    int i, j, k, w, top, entries;
+
+    if ((cfg->folds != 4 && cfg->folds != 8) || 
+        (cfg->tables != 1 && cfg->tables != 2 && cfg->tables != 4))
+    {
+        fprintf(stderr, "Folds must be 4 or 8, tables must be 1, 2 or 4.\n");
+        return 1;
+    }
+
+    w = 256/cfg->folds;
+    top = cfg->folds - 1;
+    entries = 1 << (cfg->sgn ? top : cfg->folds);
+
+    tbl = (PA_POINT*)malloc(cfg->tables*entries*sizeof(PA_POINT));
+    if (tbl == 0)
+    {
+        fprintf(stderr, "Insufficient memory error.\n");
+        return 1;
+    }
+
+    for (k = 0; k < cfg->tables; k++)
+    {
+        /* P_i = 2^(w*i)*2^(k*w/tables)*BasePoint */
+        if (k > 0) for (j = 0; j < w/cfg->tables; j++) edp_DoublePoint(&B);
+        S = B;
+        for (i = 0; i < cfg->folds; i++)
+        {
+            Ext2Affine(&P[i], &S);
+            for (j = 0; j < w; j++) edp_DoublePoint(&S);
+        }
+
+        for (i = 0; i < entries; i++)
+        {
+            Ext_POINT T = {{0},{1},{1},{0}};
+
+            if (cfg->sgn) edp_AddAffinePoint(&T, &P[top]);
+            for (j = 0; j < (cfg->sgn ? top : cfg->folds); j++)
+            {
+                if (i & (1 << j))
+                    edp_AddAffinePoint(&T, &P[j]);
+                else if (cfg->sgn)
+                {
+                    NegateAffine(&N, &P[j]);
+                    edp_AddAffinePoint(&T, &N);
+                }
+            }
+            Ext2Affine(&tbl[k*entries + i], &T);
+        }
+    }
+
+    if (cfg->sgn)
+        printf("/*\n"
+            "    This table is generated from all %d combinations of P%d + SUM(+/-P0,..,+/-P%d)\n",
+            entries, top, top - 1);
+    else
+        printf("/*\n"
+            "    This table is generated from all %d permutations of SUM(P0,P1,..,P%d)\n",
+            entries, top);
+    printf("    where P_i = 2^(%di)*BasePoint\n", w);
+    if (cfg->tables > 1)
+        printf("    Comb table k uses 2^(%dk)*P_i, layout: %s\n", 
+            w/cfg->tables, cfg->interleave ? "[entry][table]" : "[table][entry]");
+    printf("*/\n\n");
+
+    if (cfg->tables == 1)
+    {
+        printf("const %s %s[%d] =\n{\n", type, name, entries);
+        for (i = 0; i < entries; i++)
+        {
+            sprintf(comment, " /* P{%d} */", i);
+            PrintFoldEntry(cfg, &tbl[i], "  ", comment, i == entries - 1);
+        }
+    }
+    else if (cfg->interleave)
+    {
+        printf("const %s %s[%d][%d] =\n{\n", type, name, entries, cfg->tables);
+        for (i = 0; i < entries; i++)
+        {
+            printf("  { /* P{%d} */\n", i);
+            for (k = 0; k < cfg->tables; k++)
+                PrintFoldEntry(cfg, &tbl[k*entries + i], "    ", "", k == cfg->tables - 1);
+            printf((i == entries - 1) ? "  }\n" : "  },\n");
+        }
+    }
+    else
+    {
+        printf("const %s %s[%d][%d] =\n{\n", type, name, cfg->tables, entries);
+        for (k = 0; k < cfg->tables; k++)
+        {
+            printf("  { /* table %d */\n", k);
+            for (i = 0; i < entries; i++)
+            {
+                sprintf(comment, " /* P{%d} */", i);
+                PrintFoldEntry(cfg, &tbl[k*entries + i], "    ", comment, i == entries - 1);
+            }
+            printf((k == cfg->tables - 1) ? "  }\n" : "  },\n");
+        }
+    }
+    printf("};\n");
+
+    free(tbl);
+    return 0;
+}
+
+/* 
+    Self-check vectors: public keys of fixed secrets, computed with plain 
+    double-and-add on the base point, independent of the folding tables.
+*/
+int CreateCheckVectors(IN int count)
+{
+    int i, j;
+    U8 md[SHA512_DIGEST_LENGTH], *sk, *pk;
+    PA_POINT P;
+    Ext_POINT S, T = _w_BasePoint;
+    Affine_POINT R;
+
+    if (count < 1 || count > 256)
+    {
+        fprintf(stderr, "Vector count must be 1..256.\n");
+        return 1;
+    }
+
+    sk = (U8*)malloc(count*64);
+    if (sk == 0)
+    {
+        fprintf(stderr, "Insufficient memory error.\n");
+        return 1;
+    }
+    pk = sk + count*32;
+
+    Ext2Affine(&P, &T);
+
+    for (i = 0; i < count*32; i += 32)
+    {
+        for (j = 0; j < 32; j++) sk[i+j] = (U8)(i + j);
+        SHA512_32(md, &sk[i]);
+        ecp_TrimSecretKey(md);
+
+        ecp_SetValue(S.x, 0);
+        ecp_SetValue(S.y, 1);
+        ecp_SetValue(S.z, 1);
+        ecp_SetValue(S.t, 0);
+        for (j = 255; j >= 0; j--)
+        {
+            edp_DoublePoint(&S);
+            if ((md[j >> 3] >> (j & 7)) & 1) edp_AddAffinePoint(&S, &P);
+        }
+
+        ecp_Inverse(S.z, S.z);
+        ecp_MulMod(R.x, S.x, S.z);
+        ecp_MulMod(R.y, S.y, S.z);
+        ed25519_PackPoint(&pk[i], R.y, R.x[0]);
+    }
+
+    printf("/*\n"
+        "    Self-check vectors: ed25519 public keys of the secret keys below,\n"
+        "    computed by double-and-add without folding tables.\n"
+        "*/\n\n"
+        "#define ECP_BASE_CHECK_COUNT %d\n\n", count);
+    PrintBytes("ecp_BaseCheck_sk", sk, count*32);
+    PrintBytes("ecp_BaseCheck_pk", pk, count*32);
+
+    free(sk);
+    return 0;
+}
+
 int main(int argc, char**argv)
 {
     if (argc == 3 && argv[1][0] == 'b') 
         return CreateBlindingContext(argv[2]);
+    if (argc >= 3 && argc <= 8 && argv[1][0] == 'f') 
+    {
+        FOLD_CONFIG cfg = { 8, 1, 0, 0, 0 };
+        if (argc > 3) cfg.folds = atoi(argv[3]);
+        if (argc > 4) cfg.tables = atoi(argv[4]);
+        if (argc > 5) cfg.pe = (strcmp(argv[5], "pe") == 0);
+        if (argc > 6) cfg.sgn = (argv[6][0] == 's');
+        if (argc > 7) cfg.interleave = (argv[7][0] == 'e');
+        return CreateFoldingTable(argv[2], &cfg);
+    }
     if (argc == 3 && argv[1][0] == 'r') 
         return CreateRandomBytes(argv[2], 32);
     if (argc == 4 && argv[1][0] == 'r') 
@@ -152,14 +398,23 @@ int main(int argc, char**argv)
         return CreateSignTestVector(0, argv[2]);
     if (argc == 4 && argv[1][0] == 't') 
         return CreateSignTestVector(argv[2], argv[3]);
+    if (argc == 3 && argv[1][0] == 'v') 
+        return CreateCheckVectors(atoi(argv[2]));
 
     fprintf(stderr, 
         "Custom tool version " ECP_VERSION_STR ".\n"
         "\nCommand line error.\n"
         "\nCommand line arguments are:"
         "\n  b <name>            Create a random blinding context"
+        "\n  f <name> [<folds> [<tables> [pa|pe [u|s [t|e]]]]]"
+        "\n                      Create fixed-base folding table(s):"
+        "\n                      folds = 4 or 8 (8), comb tables = 1, 2 or 4 (1),"
+        "\n                      PA_POINT or PE_POINT entries (pa),"
+        "\n                      unsigned or signed digits (u),"
+        "\n                      [table][entry] or [entry][table] layout (t)"
         "\n  r <name> [<size>]   Create random bytes"
         "\n  t [<seed>] <msg>    Create key(seed) and sign(msg) with it"
+        "\n  v <count>           Create base point self-check vectors"
         "\n");
     return 1;
 }
@@ -24,9 +24,18 @@
 
 #if defined(_MSC_VER)
 #include <windows.h>
+#define RNG_THREAD  __declspec(thread)
 #else
 #include <stdio.h>
 #include <stdlib.h>
+#define RNG_THREAD  __thread
+#if defined(__linux__)
+#include <sys/random.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define RNG_FORK_CHECK
+#endif
 #endif
 #include <memory.h>
 #include "../source/sha512.h"
@@ -40,7 +49,42 @@ static const unsigned char my_secret_key[] =
     0x57,0x71,0xca,0xc2,0x19,0xdb,0x07,0xc2,0x82,0xaf,0x41,0x9f,0x57,0xb5,0x7b,0x21
 };
 
-void GetRandomBytes(unsigned char *buffer, int size)
+/* -- per-thread DRBG -------------------------------------------------------
+//
+// System RNG is only read to (re)seed a per-thread generator:
+//      block[i] = SHA512(key + 'O' + counter)
+//      key      = SHA512(key + 'K' + counter)   after every request
+//      key      = SHA512(key + 'S' + entropy)   on (re)seed
+// Reseeds after RNG_RESEED_BLOCKS output blocks and in a forked child
+// (fork generation changes), so parent and child never share a stream.
+//
+// --------------------------------------------------------------------------
+*/
+#define RNG_RESEED_BLOCKS   65536       /* 4MB of output */
+#define RNG_SEED_SIZE       64
+
+typedef struct
+{
+    unsigned char key[SHA512_DIGEST_LENGTH];
+    unsigned char buf[SHA512_DIGEST_LENGTH]; /* unused output of last block */
+    unsigned long long counter;
+    unsigned int blocks;                /* blocks since last reseed */
+    unsigned int generation;            /* fork generation when seeded */
+    int avail;                          /* bytes left in buf */
+    int seeded;
+} RNG_STATE;
+
+static RNG_THREAD RNG_STATE rng_state;
+
+#ifdef RNG_FORK_CHECK
+static volatile unsigned int rng_fork_generation;
+static pthread_once_t rng_fork_once = PTHREAD_ONCE_INIT;
+
+static void rng_AtFork(void) { rng_fork_generation++; }
+static void rng_RegisterFork(void) { pthread_atfork(0, 0, rng_AtFork); }
+#endif
+
+static void rng_SystemEntropy(unsigned char *buffer, int size)
 {
 #if defined(_MSC_VER)
     HCRYPTPROV hcp;
@@ -48,10 +92,92 @@ void GetRandomBytes(unsigned char *buffer, int size)
     CryptGenRandom(hcp, size, buffer);
     CryptReleaseContext(hcp, 0);
 #else
-    FILE *fp = fopen("/dev/urandom", "r");
+    FILE *fp;
+#if defined(__linux__)
+    if (getrandom(buffer, size, 0) == size) return;
+#endif
+    fp = fopen("/dev/urandom", "r");
     fread(buffer, sizeof(unsigned char), size, fp);
     fclose(fp);
 #endif
+}
+
+static void rng_Hash(unsigned char *md, RNG_STATE *st, unsigned char tag,
+    const void *data, size_t size)
+{
+    SHA512_CTX hash;
+
+    SHA512_Init(&hash);
+    SHA512_Update(&hash, st->key, sizeof(st->key));
+    SHA512_Update(&hash, &tag, 1);
+    SHA512_Update(&hash, data, size);
+    SHA512_Final(md, &hash);
+    memset(&hash, 0, sizeof(hash));
+}
+
+static void rng_Reseed(RNG_STATE *st)
+{
+    unsigned char seed[RNG_SEED_SIZE];
+
+    rng_SystemEntropy(seed, sizeof(seed));
+    rng_Hash(st->key, st, 'S', seed, sizeof(seed));
+    memset(seed, 0, sizeof(seed));
+    memset(st->buf, 0, sizeof(st->buf));
+    st->avail = 0;
+    st->blocks = 0;
+    st->seeded = 1;
+}
+
+static void rng_Generate(unsigned char *buffer, int size)
+{
+    RNG_STATE *st = &rng_state;
+    int n;
+
+#ifdef RNG_FORK_CHECK
+    pthread_once(&rng_fork_once, rng_RegisterFork);
+    if (st->generation != rng_fork_generation)
+    {
+        st->generation = rng_fork_generation;
+        st->seeded = 0;
+    }
+#endif
+    if (!st->seeded || st->blocks >= RNG_RESEED_BLOCKS) rng_Reseed(st);
+
+    /* leftover from previous request */
+    n = (size < st->avail) ? size : st->avail;
+    memcpy(buffer, st->buf + sizeof(st->buf) - st->avail, n);
+    memset(st->buf + sizeof(st->buf) - st->avail, 0, n);
+    st->avail -= n;
+    buffer += n;
+    size -= n;
+
+    /* bulk: full blocks straight into the output */
+    while (size >= SHA512_DIGEST_LENGTH)
+    {
+        rng_Hash(buffer, st, 'O', &st->counter, sizeof(st->counter));
+        st->counter++;
+        st->blocks++;
+        buffer += SHA512_DIGEST_LENGTH;
+        size -= SHA512_DIGEST_LENGTH;
+    }
+
+    if (size > 0)
+    {
+        rng_Hash(st->buf, st, 'O', &st->counter, sizeof(st->counter));
+        st->counter++;
+        st->blocks++;
+        memcpy(buffer, st->buf, size);
+        memset(st->buf, 0, size);
+        st->avail = SHA512_DIGEST_LENGTH - size;
+    }
+
+    /* forward secrecy: outputs so far cannot be recomputed from the state */
+    rng_Hash(st->key, st, 'K', &st->counter, sizeof(st->counter));
+}
+
+void GetRandomBytes(unsigned char *buffer, int size)
+{
+    rng_Generate(buffer, size);
 
     /* -- paranoia ----------------------------------------------------------
     //
@@ -51,11 +51,148 @@ void ed25519_SignMessage(
     const unsigned char *msg,           /* IN: [msg_size bytes] message to sign */
     size_t msg_size);                   /* IN: size of message */
 
+/*  Signing with an expanded private key.
+    ed25519_Sign_Init() hashes the secret key once and caches the secret
+    scalar, nonce prefix and public key. Blinding context (optional) must
+    remain valid while the signing context is in use.
+    ed25519_Sign_WithCtx() creates the same signature as ed25519_SignMessage().
+    ed25519_Sign_Finish() wipes and frees the context.
+*/
+void *ed25519_Sign_Init(
+    void *context,                      /* IO: null or signing context to use */
+    const unsigned char *privKey,       /* IN: [64 bytes] private key (sk,pk) */
+    const void *blinding);              /* IN: [optional] null or blinding context */
+
+void ed25519_Sign_WithCtx(
+    const void *context,                /* IN: created by ed25519_Sign_Init */
+    unsigned char *signature,           /* OUT:[64 bytes] signature (R,S) */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message to sign */
+    size_t msg_size);                   /* IN: size of message */
+
+/*  Sign count messages using the same expanded key. Nonce and challenge
+    hashes run through multi-buffer SHA-512 and all R points are encoded
+    using a shared inversion. Output is identical to ed25519_Sign_WithCtx().
+*/
+void ed25519_SignBatch(
+    const void *context,                /* IN: created by ed25519_Sign_Init */
+    unsigned char * const *signatures,  /* OUT:[count] 64-byte signatures (R,S) */
+    const unsigned char * const *msgs,  /* IN: [count] messages to sign */
+    const size_t *msg_sizes,            /* IN: [count] message sizes */
+    size_t count);                      /* IN: number of messages */
+
+void ed25519_Sign_Finish(
+    void *context);                     /* IN: signing context */
+
+/*  Offline/online signing.
+    A signing pool keeps precomputed (r, encoded(r*B)) pairs for one signing
+    context so that ed25519_Sign_FromPool() only costs one SHA-512 pass and
+    one multiply-add mod BPO. Nonces are hedged:
+        r = H(b + H(seed + instance + address) + counter) mod BPO
+    where instance is unique per pool within the process. Signatures verify
+    as usual but are NOT deterministic; the same message signs differently
+    every time. Entries are wiped as they are used.
+    seed must be at least 32 bytes of fresh random data for every pool
+    (ed25519_SignPool_Init returns null for shorter seeds): a pool in
+    another process that repeats seed and instance would repeat nonces.
+    The blinding state of the signing context is copied into the pool, so
+    ed25519_Blinding_Refresh() of the original does not affect the pool.
+    ed25519_SignPool_Refill() may be called from any thread and returns the
+    number of entries added. ed25519_SignPool_Start() starts background
+    threads that keep the pool full (POSIX only, returns number of threads
+    started). ed25519_Sign_FromPool() returns 1 when a pooled entry was
+    used and 0 when the pool was empty and the nonce was computed inline.
+    ed25519_SignPool_Finish() stops the threads, wipes and frees the pool.
+*/
+void *ed25519_SignPool_Init(
+    const void *context,                /* IN: created by ed25519_Sign_Init */
+    size_t entries,                     /* IN: pool capacity */
+    const unsigned char *seed,          /* IN: [seed_size bytes] fresh random seed */
+    size_t seed_size);                  /* IN: size of seed, at least 32 */
+
+size_t ed25519_SignPool_Refill(
+    void *pool,                         /* IN: signing pool */
+    size_t count);                      /* IN: max entries to add */
+
+int ed25519_SignPool_Start(
+    void *pool,                         /* IN: signing pool */
+    int threads);                       /* IN: number of refill threads */
+
+int ed25519_Sign_FromPool(
+    void *pool,                         /* IN: signing pool */
+    unsigned char *signature,           /* OUT:[64 bytes] signature (R,S) */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message to sign */
+    size_t msg_size);                   /* IN: size of message */
+
+void ed25519_SignPool_Finish(
+    void *pool);                        /* IN: signing pool */
+
+/*  Additive key derivation: child = parent + tweak*B.
+    Needs the parent public key only; tweaks are 32-byte little-endian
+    scalars (taken mod BPO). The parent key is not validated.
+    ed25519_DerivePublicKeys() encodes groups of keys with a shared inversion.
+    ed25519_Sign_Derive() creates the signing context of a child key from
+    the parent signing context (a' = a + tweak, b' = H(b + tweak)).
+*/
+void ed25519_DerivePublicKey(
+    unsigned char *childKey,            /* OUT:[32 bytes] child public key */
+    const unsigned char *parentKey,     /* IN: [32 bytes] parent public key */
+    const unsigned char *tweak);        /* IN: [32 bytes] tweak */
+
+void ed25519_DerivePublicKeys(
+    unsigned char *childKeys,           /* OUT:[count*32 bytes] child public keys */
+    const unsigned char *parentKey,     /* IN: [32 bytes] parent public key */
+    const unsigned char *tweaks,        /* IN: [count*32 bytes] tweaks */
+    size_t count);                      /* IN: number of keys */
+
+void *ed25519_Sign_Derive(
+    void *context,                      /* IO: null or signing context to use */
+    const void *parent,                 /* IN: created by ed25519_Sign_Init */
+    const unsigned char *tweak);        /* IN: [32 bytes] tweak */
+
+/*  Sequential keys: startKey + B, startKey + 2B, ...
+    Each step is a single point addition; keys are encoded in groups that
+    share one inversion. ed25519_KeySeq_Finish() wipes and frees the context.
+*/
+void *ed25519_KeySeq_Init(
+    void *context,                      /* IO: null or key sequence context */
+    const unsigned char *startKey);     /* IN: [32 bytes] public key */
+
+void ed25519_KeySeq_Next(
+    void *context,                      /* IN: created by ed25519_KeySeq_Init */
+    unsigned char *pubKeys,             /* OUT:[count*32 bytes] next public keys */
+    size_t count);                      /* IN: number of keys */
+
+void ed25519_KeySeq_Finish(
+    void *context);                     /* IN: key sequence context */
+
 void *ed25519_Blinding_Init(
     void *context,                      /* IO: null or ptr blinding context */
     const unsigned char *seed,          /* IN: [size bytes] random blinding seed */
     size_t size);                       /* IN: size of blinding seed */
 
+/*  Low-latency mode (opt-in).
+    Starts helper threads that spin on a dedicated core each. Base point
+    multiplications (KeyGen, Sign, DH) and signature checks then split
+    their work in two halves: one on a free helper, one on the caller,
+    joined with one point addition. Calls fall back to a single thread
+    when all helpers are busy. Call Start/Stop once, outside of other
+    library calls. helpers is capped at the number of online cores minus
+    one (the caller keeps a core). Returns the number of helpers running:
+    0 when no core is free or the library is built without threads.
+*/
+int ed25519_LowLatency_Start(
+    int helpers);                       /* IN: number of helper threads */
+
+void ed25519_LowLatency_Stop(void);
+
+/*  Re-randomize a blinding context in place (one point doubling and a few
+    field multiplications). Signatures are not affected. A context shared
+    by several threads must not be refreshed while in use; give each
+    thread its own context to refresh it per signature.
+*/
+void ed25519_Blinding_Refresh(
+    void *context);                     /* IO: blinding context */
+
 void ed25519_Blinding_Finish(
     void *context);                     /* IN: blinding context */
 
@@ -78,6 +215,21 @@ void * ed25519_Verify_Init(
     void *context,                      /* IO: null or verify context to use */
     const unsigned char *publicKey);    /* IN: [32 bytes] public key */
 
+/*  ed25519_Verify_Init() with flags.
+    ed25519_verify_strict: checks done once here reject public keys that
+    are not canonically encoded, are of small order or have a torsion
+    component (one extra multiplication, cached in the context). Every
+    Verify_Check call on the context then also rejects S >= l and small-order
+    R. Non-canonical R never matches the computed encoding, and R is
+    torsion-free whenever the (torsion-free) key verifies.
+*/
+#define ed25519_verify_strict       1
+
+void * ed25519_Verify_InitEx(
+    void *context,                      /* IO: null or verify context to use */
+    const unsigned char *publicKey,     /* IN: [32 bytes] public key */
+    int flags);                         /* IN: 0 or ed25519_verify_strict */
+
 /*  Second part of two-phase signature validation.
     Input context is output of ed25519_Verify_Init() for associated public key.
     Call it once for each message/signature pairs
@@ -89,9 +241,103 @@ int ed25519_Verify_Check(
     const unsigned char *msg,           /* IN: message to sign */
     size_t msg_size);                   /* IN: size of message */
 
+/*  Batch form of ed25519_Verify_Check().
+    Verifies count message/signature pairs against the public key of context.
+    Message hashes are computed in parallel (multi-buffer SHA-512).
+    Returns 1 if ALL signatures are valid and 0 otherwise. Individual results
+    are stored in results[] when provided.
+*/
+int ed25519_Verify_CheckBatch(
+    const void          *context,       /* IN: created by ed25519_Verify_Init */
+    size_t              count,          /* IN: number of signatures */
+    const unsigned char * const *signatures, /* IN: [count] signatures (R,S) */
+    const unsigned char * const *msgs,  /* IN: [count] messages */
+    const size_t        *msg_sizes,     /* IN: [count] message sizes */
+    int                 *results);      /* OUT: [optional] [count] 1/0 results */
+
 /* Free up context memory */
 void ed25519_Verify_Finish(void *ctx);
 
+/*  Cache of successful checks for (pk, message, signature) tuples that are
+    seen more than once. Entries are keyed by a salted SHA-512 of
+    (S, H(enc(R) + pk + m)); failures are never cached. The salt should be
+    secret random bytes so peers cannot aim at the cache buckets.
+    Capacity is rounded up to a power of two. A cache can be shared by
+    threads and by contexts of different public keys.
+*/
+void *ed25519_VerifyCache_Init(
+    size_t entries,                     /* IN: capacity in signatures */
+    const unsigned char *salt,          /* IN: [salt_size bytes] secret random salt */
+    size_t salt_size);                  /* IN: size of salt */
+
+void ed25519_VerifyCache_Finish(void *cache);
+
+/*  ed25519_Verify_Check() that consults cache before the curve work and
+    records successes. Returns 1 for SUCCESS and 0 for FAILURE
+*/
+int ed25519_Verify_CheckCached(
+    const void          *context,       /* IN: created by ed25519_Verify_Init */
+    void                *cache,         /* IN: null or ed25519_VerifyCache_Init */
+    const unsigned char *signature,     /* IN: signature (R,S) */
+    const unsigned char *msg,           /* IN: message to sign */
+    size_t msg_size);                   /* IN: size of message */
+
+/* -- context memory ---------------------------------------------------------- */
+
+/*  Allocator used by the Init functions when they are passed a null
+    context, and by the matching Finish functions. The default is
+    mem_alloc/mem_free (malloc/free). Set it before creating contexts: a
+    context must be finished under the allocator that created it.
+    Null functions restore the default.
+*/
+typedef void *(*ed25519_alloc_fn)(void *user, size_t size);
+typedef void (*ed25519_free_fn)(void *user, void *ptr);
+
+void ed25519_SetAllocator(
+    ed25519_alloc_fn alloc_fn,          /* IN: null or allocate function */
+    ed25519_free_fn free_fn,            /* IN: null or free function */
+    void *user);                        /* IN: passed to alloc_fn and free_fn */
+
+/*  Built-in slab arena: 64-byte aligned blocks of up to 4 KB, carved from
+    2 MB slabs (huge pages where the OS provides them), one block size per
+    slab. Freed blocks are reused and ed25519_Arena_Destroy() releases
+    (and wipes) every slab at once. Route contexts through an arena with:
+        ed25519_SetAllocator(ed25519_Arena_Alloc, ed25519_Arena_Free, arena);
+*/
+void *ed25519_Arena_Create(void);
+void ed25519_Arena_Destroy(void *arena);
+void *ed25519_Arena_Alloc(void *arena, size_t size);
+void ed25519_Arena_Free(void *arena, void *ptr);
+
+/* -- latency histograms ------------------------------------------------------- */
+
+/*  Libraries built with ECP_LATENCY=1 keep a latency histogram of every
+    public sign, verify and DH function. Buckets are log-linear: one per
+    nanosecond below 8 ns, then 8 per power of two (bucket i covers
+    ed25519_Latency_BucketStart(i) up to the start of bucket i+1).
+    ed25519_Latency_Snapshot copies up to max histograms and returns the
+    number of APIs, or 0 when the library was built without histograms.
+    Recording is lock-free; snapshots may be taken from any thread.
+*/
+#define ed25519_latency_buckets     304
+
+typedef struct
+{
+    const char *name;                   /* API function name */
+    unsigned long long count;           /* number of calls */
+    unsigned long long total_ns;        /* sum of latencies */
+    unsigned long long bucket[ed25519_latency_buckets];
+} ed25519_latency;
+
+int ed25519_Latency_Snapshot(
+    ed25519_latency *hist,              /* OUT: [max] histograms */
+    int max);                           /* IN: size of hist */
+
+unsigned long long ed25519_Latency_BucketStart(
+    int bucket);                        /* IN: 0..ed25519_latency_buckets-1 */
+
+void ed25519_Latency_Reset(void);
+
 #ifdef __cplusplus
 }
 #endif
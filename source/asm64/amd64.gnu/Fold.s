@@ -94,3 +94,82 @@ f8t_1:
     ret
     
     
+
+/* _______________________________________________________________________
+// SIGNED_K
+// Out: A3:A0 = (X >> 1) + 2^255, X must be odd
+//      Bit i of result selects +2^i (1) or -2^i (0)
+// _______________________________________________________________________ */
+.macro    SIGNED_K
+    shrd    $1,A1,A0
+    shrd    $1,A2,A1
+    shrd    $1,A3,A2
+    stc
+    rcr     $1,A3
+.endm
+
+/* _______________________________________________________________________
+//
+//   void ecp_4SignedFolds(U8* Y, const U64* X)
+//   Y[i] = (neg << 3) | index, X must be odd
+// _______________________________________________________________________ */
+
+.equ  Y,  ARG1
+.equ  X,  ARG2
+
+    PUBPROC ecp_4SignedFolds
+
+    LOADA   X
+    SIGNED_K
+    mov     $64,%ah
+f4s_1:
+    mov     $0,%al
+    RL_MSB  %al,A3
+    RL_MSB  %al,A2
+    RL_MSB  %al,A1
+    RL_MSB  %al,A0
+    mov     %al,%dl
+    shl     $4,%dl
+    sar     $7,%dl
+    not     %dl
+    and     $0x07,%dl
+    xor     $0x08,%dl
+    xor     %al,%dl
+    mov     %dl,(Y)
+    inc     Y
+    dec     %ah
+    jnz.s   f4s_1
+    ret
+
+/* _______________________________________________________________________
+//
+//   void ecp_8SignedFolds(U8* Y, const U64* X)
+//   Y[i] = (neg << 7) | index, X must be odd
+// _______________________________________________________________________ */
+
+.equ  Y,  ARG1
+.equ  X,  ARG2
+
+    PUBPROC ecp_8SignedFolds
+
+    LOADA   X
+    SIGNED_K
+    mov     $32,%ah
+f8s_1:
+    RL_MSBS %al,A3
+    RL_MSBS %al,A2
+    RL_MSBS %al,A1
+    RL_MSBS %al,A0
+    mov     %al,%dl
+    sar     $7,%dl
+    not     %dl
+    and     $0x7F,%dl
+    xor     $0x80,%dl
+    xor     %al,%dl
+    mov     %dl,(Y)
+    inc     Y
+    dec     %ah
+    jnz.s   f8s_1
+    ret
+
+
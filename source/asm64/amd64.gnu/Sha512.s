@@ -0,0 +1,506 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+.include "defines.inc"
+
+/* _______________________________________________________________________
+//
+//  SHA-512 block transform
+//
+//  void sha512_block_x64(U64 *h, const void *in, size_t num)
+//  void sha512_block_avx2(U64 *h, const void *in, size_t num)
+//
+//  Process num 128-byte blocks of big-endian input and update state h[8].
+//  sha512_block_x64:  plain x86-64 instructions.
+//  sha512_block_avx2: message schedule of two blocks at a time in ymm
+//                     registers (one block per 128-bit lane), rounds use
+//                     BMI2 rorx/andn. Requires AVX2 and BMI2.
+// _______________________________________________________________________ */
+
+.equ  ST_A,   %r8
+.equ  ST_B,   %r9
+.equ  ST_C,   %r10
+.equ  ST_D,   %r11
+.equ  ST_E,   %r12
+.equ  ST_F,   %r13
+.equ  ST_G,   %r14
+.equ  ST_H,   %r15
+
+.equ  HP,     %rdi      /* state */
+.equ  INP,    %rsi      /* input */
+.equ  KP,     %rbp      /* K512 / WK pointer */
+
+/* Sigma1(e) = ror14 ^ ror18 ^ ror41,  Ch(e,f,g) = ((f ^ g) & e) ^ g
+// Sigma0(a) = ror28 ^ ror34 ^ ror39,  Maj(a,b,c) = ((a | c) & b) | (a & c)
+// T1 = h + Sigma1(e) + Ch(e,f,g) + K[t] + W[t]
+// d += T1;  h = T1 + Sigma0(a) + Maj(a,b,c) */
+.macro  ROUND_X64 a,b,c,d,e,f,g,h,wk
+    add     \wk,\h
+    mov     \e,%rax
+    mov     \f,%rbx
+    ror     $23,%rax
+    xor     \g,%rbx
+    xor     \e,%rax
+    and     \e,%rbx
+    ror     $4,%rax
+    xor     \g,%rbx
+    xor     \e,%rax
+    add     %rbx,\h
+    ror     $14,%rax
+    mov     \a,%rcx
+    add     %rax,\h
+    mov     \a,%rbx
+    ror     $5,%rcx
+    or      \c,%rbx
+    xor     \a,%rcx
+    and     \b,%rbx
+    ror     $6,%rcx
+    mov     \a,%rdx
+    xor     \a,%rcx
+    and     \c,%rdx
+    ror     $28,%rcx
+    or      %rdx,%rbx
+    add     \h,\d
+    add     %rcx,\h
+    add     %rbx,\h
+.endm
+
+/* Same round using BMI2: Ch(e,f,g) = (e & f) + (~e & g) */
+.macro  ROUND_BMI2 a,b,c,d,e,f,g,h,wk
+    add     \wk,\h
+    rorx    $41,\e,%rax
+    rorx    $18,\e,%rbx
+    rorx    $14,\e,%rcx
+    xor     %rbx,%rax
+    andn    \g,\e,%rbx
+    xor     %rcx,%rax
+    mov     \e,%rcx
+    add     %rbx,\h
+    and     \f,%rcx
+    add     %rax,\h
+    rorx    $39,\a,%rax
+    add     %rcx,\h
+    rorx    $34,\a,%rbx
+    rorx    $28,\a,%rcx
+    xor     %rbx,%rax
+    add     \h,\d
+    xor     %rcx,%rax
+    mov     \a,%rbx
+    mov     \a,%rcx
+    or      \c,%rbx
+    and     \c,%rcx
+    and     \b,%rbx
+    add     %rax,\h
+    or      %rcx,%rbx
+    add     %rbx,\h
+.endm
+
+/* W[j] = bswap(in[j]), %rax = W[j] + K[j] */
+.macro  LOAD_X64 j
+    mov     \j*8(INP),%rax
+    bswap   %rax
+    mov     %rax,\j*8(%rsp)
+    add     \j*8(KP),%rax
+.endm
+
+/* W[j] += sigma0(W[j+1]) + sigma1(W[j+14]) + W[j+9], %rax = W[j] + K[j]
+// sigma0(x) = ror1 ^ ror8 ^ shr7,  sigma1(x) = ror19 ^ ror61 ^ shr6 */
+.macro  SCHED_X64 j
+    mov     ((\j+1)&15)*8(%rsp),%rax
+    mov     ((\j+14)&15)*8(%rsp),%rcx
+    mov     %rax,%rbx
+    mov     %rcx,%rdx
+    ror     $7,%rax
+    ror     $42,%rcx
+    xor     %rbx,%rax
+    xor     %rdx,%rcx
+    ror     $1,%rax
+    ror     $19,%rcx
+    shr     $7,%rbx
+    shr     $6,%rdx
+    xor     %rbx,%rax
+    xor     %rdx,%rcx
+    add     %rcx,%rax
+    add     ((\j+9)&15)*8(%rsp),%rax
+    add     \j*8(%rsp),%rax
+    mov     %rax,\j*8(%rsp)
+    add     \j*8(KP),%rax
+.endm
+
+.macro  PUSH_REGS
+    push    %rbx
+    push    %rbp
+    push    %r12
+    push    %r13
+    push    %r14
+    push    %r15
+    push    %rdi
+    push    %rsi
+.ifdef MSVC
+    mov     %rcx,%rdi
+    mov     %rdx,%rsi
+    mov     %r8,%rdx
+.endif
+.endm
+
+.macro  POP_REGS
+    pop     %rsi
+    pop     %rdi
+    pop     %r15
+    pop     %r14
+    pop     %r13
+    pop     %r12
+    pop     %rbp
+    pop     %rbx
+.endm
+
+.macro  LOAD_STATE
+    mov     (HP),ST_A
+    mov     8(HP),ST_B
+    mov     16(HP),ST_C
+    mov     24(HP),ST_D
+    mov     32(HP),ST_E
+    mov     40(HP),ST_F
+    mov     48(HP),ST_G
+    mov     56(HP),ST_H
+.endm
+
+.macro  ADD_STATE
+    add     (HP),ST_A
+    add     8(HP),ST_B
+    add     16(HP),ST_C
+    add     24(HP),ST_D
+    add     32(HP),ST_E
+    add     40(HP),ST_F
+    add     48(HP),ST_G
+    add     56(HP),ST_H
+    mov     ST_A,(HP)
+    mov     ST_B,8(HP)
+    mov     ST_C,16(HP)
+    mov     ST_D,24(HP)
+    mov     ST_E,32(HP)
+    mov     ST_F,40(HP)
+    mov     ST_G,48(HP)
+    mov     ST_H,56(HP)
+.endm
+
+/* _______________________________________________________________________
+//
+//  void sha512_block_x64(U64 *h, const void *in, size_t num)
+//  Stack: W[16], num
+// _______________________________________________________________________ */
+
+    PUBPROC sha512_block_x64
+
+    PUSH_REGS
+    sub     $136,%rsp
+    mov     %rdx,128(%rsp)
+    test    %rdx,%rdx
+    jz      sbx_3
+    LOAD_STATE
+sbx_1:
+    lea     K512_x64(%rip),KP
+
+    LOAD_X64 0
+    ROUND_X64 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,%rax
+    LOAD_X64 1
+    ROUND_X64 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,%rax
+    LOAD_X64 2
+    ROUND_X64 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,%rax
+    LOAD_X64 3
+    ROUND_X64 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,%rax
+    LOAD_X64 4
+    ROUND_X64 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,%rax
+    LOAD_X64 5
+    ROUND_X64 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,%rax
+    LOAD_X64 6
+    ROUND_X64 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,%rax
+    LOAD_X64 7
+    ROUND_X64 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,%rax
+    LOAD_X64 8
+    ROUND_X64 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,%rax
+    LOAD_X64 9
+    ROUND_X64 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,%rax
+    LOAD_X64 10
+    ROUND_X64 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,%rax
+    LOAD_X64 11
+    ROUND_X64 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,%rax
+    LOAD_X64 12
+    ROUND_X64 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,%rax
+    LOAD_X64 13
+    ROUND_X64 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,%rax
+    LOAD_X64 14
+    ROUND_X64 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,%rax
+    LOAD_X64 15
+    ROUND_X64 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,%rax
+sbx_2:
+    add     $128,KP
+    SCHED_X64 0
+    ROUND_X64 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,%rax
+    SCHED_X64 1
+    ROUND_X64 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,%rax
+    SCHED_X64 2
+    ROUND_X64 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,%rax
+    SCHED_X64 3
+    ROUND_X64 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,%rax
+    SCHED_X64 4
+    ROUND_X64 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,%rax
+    SCHED_X64 5
+    ROUND_X64 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,%rax
+    SCHED_X64 6
+    ROUND_X64 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,%rax
+    SCHED_X64 7
+    ROUND_X64 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,%rax
+    SCHED_X64 8
+    ROUND_X64 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,%rax
+    SCHED_X64 9
+    ROUND_X64 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,%rax
+    SCHED_X64 10
+    ROUND_X64 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,%rax
+    SCHED_X64 11
+    ROUND_X64 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,%rax
+    SCHED_X64 12
+    ROUND_X64 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,%rax
+    SCHED_X64 13
+    ROUND_X64 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,%rax
+    SCHED_X64 14
+    ROUND_X64 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,%rax
+    SCHED_X64 15
+    ROUND_X64 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,%rax
+    lea     K512_x64+512(%rip),%rax
+    cmp     %rax,KP
+    jb      sbx_2
+
+    ADD_STATE
+    add     $128,INP
+    decq    128(%rsp)
+    jnz     sbx_1
+sbx_3:
+    add     $136,%rsp
+    POP_REGS
+    ret
+
+/* _______________________________________________________________________
+// Two-block message schedule, ymm lane 0: block n, lane 1: block n+1.
+// X0..X7 hold W[t-16..t-1] in pairs. Calculates:
+//   X0 = W[t..t+1] = X0 + sigma0(W[t-15..t-14]) + W[t-7..t-6] + sigma1(X7)
+//   WK[t..t+1] = X0 + K[t..t+1]
+// _______________________________________________________________________ */
+.macro  SCHED_AVX2 x0,x1,x4,x5,x7,j
+    vpalignr $8,\x0,\x1,%ymm8         /* W[t-15..t-14] */
+    vpalignr $8,\x4,\x5,%ymm9         /* W[t-7..t-6] */
+    vpsrlq  $1,%ymm8,%ymm10
+    vpsllq  $63,%ymm8,%ymm11
+    vpaddq  %ymm9,\x0,\x0
+    vpxor   %ymm11,%ymm10,%ymm10
+    vpsrlq  $8,%ymm8,%ymm9
+    vpsllq  $56,%ymm8,%ymm11
+    vpxor   %ymm9,%ymm10,%ymm10
+    vpsrlq  $7,%ymm8,%ymm8
+    vpxor   %ymm11,%ymm10,%ymm10
+    vpsrlq  $19,\x7,%ymm9
+    vpxor   %ymm8,%ymm10,%ymm10       /* sigma0 */
+    vpsllq  $45,\x7,%ymm11
+    vpaddq  %ymm10,\x0,\x0
+    vpxor   %ymm11,%ymm9,%ymm9
+    vpsrlq  $61,\x7,%ymm10
+    vpsllq  $3,\x7,%ymm11
+    vpxor   %ymm10,%ymm9,%ymm9
+    vpsrlq  $6,\x7,%ymm10
+    vpxor   %ymm11,%ymm9,%ymm9
+    vpxor   %ymm10,%ymm9,%ymm9        /* sigma1 */
+    vpaddq  %ymm9,\x0,\x0
+    vbroadcasti128 \j*16(KP),%ymm8
+    vpaddq  \x0,%ymm8,%ymm8
+    vmovdqa %ymm8,\j*32(%rax)
+.endm
+
+/* load W[2j..2j+1] of both blocks */
+.macro  LOAD_AVX2 x,j
+    vmovdqu \j*16(INP),%xmm8
+    vinserti128 $1,\j*16(%rdx),%ymm8,%ymm8
+    vpshufb %ymm12,%ymm8,\x
+    vbroadcasti128 \j*16(KP),%ymm8
+    vpaddq  \x,%ymm8,%ymm8
+    vmovdqa %ymm8,\j*32(%rax)
+.endm
+
+/* _______________________________________________________________________
+//
+//  void sha512_block_avx2(U64 *h, const void *in, size_t num)
+//  Stack: WK[80] of both blocks in pairs (1280 bytes), num, rsp, xmm6-12
+// _______________________________________________________________________ */
+
+    PUBPROC sha512_block_avx2
+
+    PUSH_REGS
+    mov     %rsp,%rax
+    sub     $1472,%rsp
+    and     $-64,%rsp
+    mov     %rax,1288(%rsp)
+    mov     %rdx,1280(%rsp)
+.ifdef MSVC
+    vmovdqu %xmm6,1296(%rsp)
+    vmovdqu %xmm7,1312(%rsp)
+    vmovdqu %xmm8,1328(%rsp)
+    vmovdqu %xmm9,1344(%rsp)
+    vmovdqu %xmm10,1360(%rsp)
+    vmovdqu %xmm11,1376(%rsp)
+    vmovdqu %xmm12,1392(%rsp)
+.endif
+    test    %rdx,%rdx
+    jz      sba_4
+    LOAD_STATE
+    vmovdqa BSWAP_x64(%rip),%ymm12
+sba_1:
+    /* second block, or first block again if num = 1 */
+    lea     128(INP),%rdx
+    cmpq    $1,1280(%rsp)
+    cmove   INP,%rdx
+    lea     K512_x64(%rip),KP
+    mov     %rsp,%rax
+    LOAD_AVX2 %ymm0,0
+    LOAD_AVX2 %ymm1,1
+    LOAD_AVX2 %ymm2,2
+    LOAD_AVX2 %ymm3,3
+    LOAD_AVX2 %ymm4,4
+    LOAD_AVX2 %ymm5,5
+    LOAD_AVX2 %ymm6,6
+    LOAD_AVX2 %ymm7,7
+sba_2:
+    add     $128,KP
+    add     $256,%rax
+    SCHED_AVX2 %ymm0,%ymm1,%ymm4,%ymm5,%ymm7,0
+    SCHED_AVX2 %ymm1,%ymm2,%ymm5,%ymm6,%ymm0,1
+    SCHED_AVX2 %ymm2,%ymm3,%ymm6,%ymm7,%ymm1,2
+    SCHED_AVX2 %ymm3,%ymm4,%ymm7,%ymm0,%ymm2,3
+    SCHED_AVX2 %ymm4,%ymm5,%ymm0,%ymm1,%ymm3,4
+    SCHED_AVX2 %ymm5,%ymm6,%ymm1,%ymm2,%ymm4,5
+    SCHED_AVX2 %ymm6,%ymm7,%ymm2,%ymm3,%ymm5,6
+    SCHED_AVX2 %ymm7,%ymm0,%ymm3,%ymm4,%ymm6,7
+    lea     K512_x64+512(%rip),%rbx
+    cmp     %rbx,KP
+    jb      sba_2
+
+    /* rounds of first block */
+    mov     %rsp,KP
+    call    sba_rounds
+    ADD_STATE
+    add     $128,INP
+    decq    1280(%rsp)
+    jz      sba_4
+
+    /* rounds of second block */
+    lea     16(%rsp),KP
+    call    sba_rounds
+    ADD_STATE
+    add     $128,INP
+    decq    1280(%rsp)
+    jnz     sba_1
+sba_4:
+    vzeroupper
+.ifdef MSVC
+    vmovdqu 1296(%rsp),%xmm6
+    vmovdqu 1312(%rsp),%xmm7
+    vmovdqu 1328(%rsp),%xmm8
+    vmovdqu 1344(%rsp),%xmm9
+    vmovdqu 1360(%rsp),%xmm10
+    vmovdqu 1376(%rsp),%xmm11
+    vmovdqu 1392(%rsp),%xmm12
+.endif
+    mov     1288(%rsp),%rsp
+    POP_REGS
+    ret
+
+/* 80 rounds, KP -> WK of the block (pairs 32 bytes apart) */
+sba_rounds:
+    lea     1280(KP),%rdx
+sba_6:
+    ROUND_BMI2 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,0(KP)
+    ROUND_BMI2 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,8(KP)
+    ROUND_BMI2 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,32(KP)
+    ROUND_BMI2 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,40(KP)
+    ROUND_BMI2 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,64(KP)
+    ROUND_BMI2 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,72(KP)
+    ROUND_BMI2 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,96(KP)
+    ROUND_BMI2 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,104(KP)
+    ROUND_BMI2 %r8,%r9,%r10,%r11,%r12,%r13,%r14,%r15,128(KP)
+    ROUND_BMI2 %r15,%r8,%r9,%r10,%r11,%r12,%r13,%r14,136(KP)
+    ROUND_BMI2 %r14,%r15,%r8,%r9,%r10,%r11,%r12,%r13,160(KP)
+    ROUND_BMI2 %r13,%r14,%r15,%r8,%r9,%r10,%r11,%r12,168(KP)
+    ROUND_BMI2 %r12,%r13,%r14,%r15,%r8,%r9,%r10,%r11,192(KP)
+    ROUND_BMI2 %r11,%r12,%r13,%r14,%r15,%r8,%r9,%r10,200(KP)
+    ROUND_BMI2 %r10,%r11,%r12,%r13,%r14,%r15,%r8,%r9,224(KP)
+    ROUND_BMI2 %r9,%r10,%r11,%r12,%r13,%r14,%r15,%r8,232(KP)
+    add     $256,KP
+    cmp     %rdx,KP
+    jb      sba_6
+    ret
+
+.align 64
+BSWAP_x64:
+    .byte   7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8
+    .byte   7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8
+
+K512_x64:
+    .quad   0x428a2f98d728ae22,0x7137449123ef65cd
+    .quad   0xb5c0fbcfec4d3b2f,0xe9b5dba58189dbbc
+    .quad   0x3956c25bf348b538,0x59f111f1b605d019
+    .quad   0x923f82a4af194f9b,0xab1c5ed5da6d8118
+    .quad   0xd807aa98a3030242,0x12835b0145706fbe
+    .quad   0x243185be4ee4b28c,0x550c7dc3d5ffb4e2
+    .quad   0x72be5d74f27b896f,0x80deb1fe3b1696b1
+    .quad   0x9bdc06a725c71235,0xc19bf174cf692694
+    .quad   0xe49b69c19ef14ad2,0xefbe4786384f25e3
+    .quad   0x0fc19dc68b8cd5b5,0x240ca1cc77ac9c65
+    .quad   0x2de92c6f592b0275,0x4a7484aa6ea6e483
+    .quad   0x5cb0a9dcbd41fbd4,0x76f988da831153b5
+    .quad   0x983e5152ee66dfab,0xa831c66d2db43210
+    .quad   0xb00327c898fb213f,0xbf597fc7beef0ee4
+    .quad   0xc6e00bf33da88fc2,0xd5a79147930aa725
+    .quad   0x06ca6351e003826f,0x142929670a0e6e70
+    .quad   0x27b70a8546d22ffc,0x2e1b21385c26c926
+    .quad   0x4d2c6dfc5ac42aed,0x53380d139d95b3df
+    .quad   0x650a73548baf63de,0x766a0abb3c77b2a8
+    .quad   0x81c2c92e47edaee6,0x92722c851482353b
+    .quad   0xa2bfe8a14cf10364,0xa81a664bbc423001
+    .quad   0xc24b8b70d0f89791,0xc76c51a30654be30
+    .quad   0xd192e819d6ef5218,0xd69906245565a910
+    .quad   0xf40e35855771202a,0x106aa07032bbd1b8
+    .quad   0x19a4c116b8d2d0c8,0x1e376c085141ab53
+    .quad   0x2748774cdf8eeb99,0x34b0bcb5e19b48a8
+    .quad   0x391c0cb3c5c95a63,0x4ed8aa4ae3418acb
+    .quad   0x5b9cca4f7763e373,0x682e6ff3d6b2b8a3
+    .quad   0x748f82ee5defb2fc,0x78a5636f43172f60
+    .quad   0x84c87814a1f0ab72,0x8cc702081a6439ec
+    .quad   0x90befffa23631e28,0xa4506cebde82bde9
+    .quad   0xbef9a3f7b2c67915,0xc67178f2e372532b
+    .quad   0xca273eceea26619c,0xd186b8c721c0c207
+    .quad   0xeada7dd6cde0eb1e,0xf57d4f7fee6ed178
+    .quad   0x06f067aa72176fba,0x0a637dc5a2c898a6
+    .quad   0x113f9804bef90dae,0x1b710b35131c471b
+    .quad   0x28db77f523047d84,0x32caab7b40c72493
+    .quad   0x3c9ebe0a15c9bebc,0x431d67c49c100d4c
+    .quad   0x4cc5d4becb3e42b6,0x597f299cfc657e2a
+    .quad   0x5fcb6fab3ad6faec,0x6c44198c4a475817
@@ -167,3 +167,77 @@
     PopB
     ret
   
+
+# _______________________________________________________________________
+#
+#   REDUCE_STEP: [x3:x0] = [bb:x3:x0] mod BPO
+#   Same folding as eco_ReduceHiWord on registers. Uses B0..B3, ACL, ACH.
+# _______________________________________________________________________
+.macro  REDUCE_STEP x3,x2,x1,x0,bb
+    mov     \bb,B2
+    MULSET  B1,B0,$0x812631A5CF5D3ED0,B2
+    MULT    $0x4DEF9DEA2F79CD65,B2
+    xor     B3,B3
+    add     ACL,B1
+    adc     ACH,B2
+    adc     B3,B3
+
+    SUB4    \x3,\x2,\x1,\x0, B3,B2,B1,B0
+
+    # Add BPO if there is a carry
+    sbb     ACL,ACL
+    mov     $0x5812631A5CF5D3ED,B0
+    mov     $0x14DEF9DEA2F79CD6,B1
+    mov     $0x1000000000000000,B3
+    and     ACL,B0
+    and     ACL,B1
+    and     ACL,B3
+    add     B0,\x0
+    adc     B1,\x1
+    adc     $0,\x2
+    adc     B3,\x3
+.endm
+
+# _______________________________________________________________________
+#
+#   Calculate: Y = T mod BPO where T is 512-bit
+#   void eco_Reduce512(U64* Y, const U64* T)
+#
+#   Four REDUCE_STEPs from the top word down. The 256-bit window rotates
+#   through A0..A3,C0 so T is read once and Y is written once.
+#   Constant-time
+# _______________________________________________________________________
+    PUBPROC eco_Reduce512
+
+    PushB
+    SaveArg1
+    SaveArg2
+
+.equ  Y,  ARG1M
+.equ  T,  ARG2M
+
+    mov     24(T),A0
+    mov     32(T),A1
+    mov     40(T),A2
+    mov     48(T),A3
+    mov     56(T),C0
+    REDUCE_STEP A3,A2,A1,A0,C0
+
+    mov     16(T),C0
+    REDUCE_STEP A2,A1,A0,C0,A3
+
+    mov     8(T),A3
+    REDUCE_STEP A1,A0,C0,A3,A2
+
+    mov     (T),A2
+    REDUCE_STEP A0,C0,A3,A2,A1
+
+    mov     A2,(Y)
+    mov     A3,8(Y)
+    mov     C0,16(Y)
+    mov     A0,24(Y)
+
+    RestoreArg2
+    RestoreArg1
+    PopB
+    ret
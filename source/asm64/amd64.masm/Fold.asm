@@ -97,4 +97,84 @@ f8t_1:
     ret
 ENDPROC ecp_8Folds
 
+;
+; _______________________________________________________________________
+; SIGNED_K
+; Out: A3:A0 = (X >> 1) + 2^255, X must be odd
+;      Bit i of result selects +2^i (1) or -2^i (0)
+; _______________________________________________________________________
+SIGNED_K macro
+    shrd    A0,A1,1
+    shrd    A1,A2,1
+    shrd    A2,A3,1
+    stc
+    rcr     A3,1
+    endm
+
+; _______________________________________________________________________
+;
+;   void ecp_4SignedFolds(U8* Y, const U64* X)
+;   Y is 64-bytes long, Y[i] = (neg << 3) | index, X must be odd
+; _______________________________________________________________________
+
+PUBPROC ecp_4SignedFolds
+
+Y   equ ARG1
+X   equ ARG2
+
+    LOADA   X
+    SIGNED_K
+    mov     ah,64
+f4s_1:
+    mov     al,0
+    RL_MSB  al,A3
+    RL_MSB  al,A2
+    RL_MSB  al,A1
+    RL_MSB  al,A0
+    mov     dl,al
+    shl     dl,4
+    sar     dl,7
+    not     dl
+    and     dl,07h
+    xor     dl,08h
+    xor     dl,al
+    mov     [Y],dl
+    inc     Y
+    dec     ah
+    jnz     short f4s_1
+    ret
+ENDPROC ecp_4SignedFolds
+
+; _______________________________________________________________________
+;
+;   void ecp_8SignedFolds(U8* Y, const U64* X) 
+;   Y is 32-bytes long, Y[i] = (neg << 7) | index, X must be odd
+; _______________________________________________________________________
+
+PUBPROC ecp_8SignedFolds
+
+Y   equ ARG1
+X   equ ARG2
+
+    LOADA   X
+    SIGNED_K
+    mov     ah,32
+f8s_1:
+    RL_MSBS al,A3
+    RL_MSBS al,A2
+    RL_MSBS al,A1
+    RL_MSBS al,A0
+    mov     dl,al
+    sar     dl,7
+    not     dl
+    and     dl,7Fh
+    xor     dl,80h
+    xor     dl,al
+    mov     [Y],dl
+    inc     Y
+    dec     ah
+    jnz     short f8s_1
+    ret
+ENDPROC ecp_8SignedFolds
+
 END
\ No newline at end of file
@@ -171,4 +171,80 @@ X   equ ARG3
 
 ENDPROC eco_ReduceHiWord
 
+; _______________________________________________________________________
+;
+;   REDUCE_STEP: [x3:x0] = [bb:x3:x0] mod BPO
+;   Same folding as eco_ReduceHiWord on registers. Uses B0..B3, ACL, ACH.
+; _______________________________________________________________________
+REDUCE_STEP macro x3,x2,x1,x0,bb
+    mov     B2,bb
+    MULSET  B1,B0,812631A5CF5D3ED0h,B2
+    MULT    4DEF9DEA2F79CD65h,B2
+    xor     B3,B3
+    add     B1,ACL
+    adc     B2,ACH
+    adc     B3,B3
+
+    SUB4    x3,x2,x1,x0, B3,B2,B1,B0
+
+    ; Add BPO if there is a carry
+    sbb     ACL,ACL
+    mov     B0,5812631A5CF5D3EDh
+    mov     B1,14DEF9DEA2F79CD6h
+    mov     B3,1000000000000000h
+    and     B0,ACL
+    and     B1,ACL
+    and     B3,ACL
+    add     x0,B0
+    adc     x1,B1
+    adc     x2,0
+    adc     x3,B3
+    endm
+
+; _______________________________________________________________________
+;
+;   Calculate: Y = T mod BPO where T is 512-bit
+;   void eco_Reduce512(U64* Y, const U64* T)
+;
+;   Four REDUCE_STEPs from the top word down. The 256-bit window rotates
+;   through A0..A3,C0 so T is read once and Y is written once.
+;   Constant-time
+; _______________________________________________________________________
+PUBPROC eco_Reduce512
+
+    PushB
+    SaveArg1
+    SaveArg2
+
+Y   equ ARG1M
+T   equ ARG2M
+
+    mov     A0,[T+24]
+    mov     A1,[T+32]
+    mov     A2,[T+40]
+    mov     A3,[T+48]
+    mov     C0,[T+56]
+    REDUCE_STEP A3,A2,A1,A0,C0
+
+    mov     C0,[T+16]
+    REDUCE_STEP A2,A1,A0,C0,A3
+
+    mov     A3,[T+8]
+    REDUCE_STEP A1,A0,C0,A3,A2
+
+    mov     A2,[T]
+    REDUCE_STEP A0,C0,A3,A2,A1
+
+    mov     [Y],A2
+    mov     [Y+8],A3
+    mov     [Y+16],C0
+    mov     [Y+24],A0
+
+    RestoreArg2
+    RestoreArg1
+    PopB
+    ret
+
+ENDPROC eco_Reduce512
+
 END
\ No newline at end of file
@@ -0,0 +1,648 @@
+/*
+    This table is generated from all 128 combinations of P7 + SUM(+/-P0,..,+/-P6)
+    where P_i = 2^(32i)*BasePoint
+*/
+
+const PA_POINT _w_base_folding8[128] =
+{
+  { /* P{0} */
+    W256(0x18EBD093,0x139DA696,0x2EAD8498,0x3FD71999,0x0BB31BD6,0x2A377134,0xEB411392,0x1307D495),
+    W256(0x1E0DD14F,0x8A0A4513,0x0944E8C6,0xA2BCC5D8,0xDFAFDE97,0x9C304D82,0x2FCEB256,0x6EDD4A04),
+    W256(0xA87D4DEC,0xD2E6B216,0x176DEC0A,0x2551BE30,0x6D6EBB66,0x2AE4447D,0x44E659CB,0x4B4513F2)
+  },
+  { /* P{1} */
+    W256(0x88451E14,0x7CEB514D,0x65B2E893,0xA457C4FB,0xB1507B78,0xE3A9C1DF,0xF21AD326,0x6FA192C5),
+    W256(0x76642F7A,0xFC14DF84,0xDBC6084B,0xBC0CFDB9,0x571CD5B4,0x6A128FC1,0x63693821,0x1D20700A),
+    W256(0xE59CA87E,0xF14433C6,0xBA0CA232,0x9DC46E4A,0xD77B91BF,0x40DB477A,0x777517D5,0x05C8738D)
+  },
+  { /* P{2} */
+    W256(0x4D1940C8,0x06823AD1,0x75103DF5,0x471395A7,0x67FEC5ED,0x2DC034A7,0x63C602B3,0x1E5A840D),
+    W256(0xF803ABD9,0xAA826187,0x15211941,0x80F3EB7D,0x5F859D8F,0x235D51DD,0x5BB4305D,0x515823DD),
+    W256(0x5EF14761,0x6DCB02B0,0x401E79F4,0xDE2F3AD5,0x708B0A2F,0x6EDB0079,0x27549EC5,0x53208660)
+  },
+  { /* P{3} */
+    W256(0xBAF0D6D8,0xFB681871,0x0D25068B,0xAEEF51C7,0xEE56CB0B,0x30DB95A1,0x55D00E15,0x4E758A43),
+    W256(0x9D6B2398,0x3B593F6B,0xE5D6814C,0xD2B498A5,0x035DA810,0x11570D60,0x93559865,0x09180BB0),
+    W256(0x73710B6D,0x3B215C5A,0xBFA79994,0x582E9A3C,0xC9290AE4,0xCB9E13CE,0x23B04C31,0x5C0548C1)
+  },
+  { /* P{4} */
+    W256(0xAE253C40,0x323D5E17,0x56089845,0xE4BBBB11,0x11241BE2,0x40E3E784,0xDE5449BF,0x25429E52),
+    W256(0xE64DC9EA,0x5FA58361,0x47DF7FA0,0xC4A50178,0x9AE01371,0x5909837D,0x58123BCC,0x489099EF),
+    W256(0x61BDDB1C,0x2DC946F0,0xF788EEE5,0x34F99ECA,0xC73D38D2,0x72458B3B,0x40DE0587,0x48BED97D)
+  },
+  { /* P{5} */
+    W256(0x1A53A155,0x0316D0FC,0xCFD0A344,0x82C64B1D,0x191B4B63,0x86555196,0xDB13DF18,0x3A6174C4),
+    W256(0xEC80EE8F,0x1427EC12,0xC8E0EEB1,0x0E44E1ED,0xB841C866,0x5D0C40AD,0x8CC59BD3,0x4E8EC798),
+    W256(0xB5A0F69A,0xD673705F,0xF06E87C2,0xDBB5A478,0x1E6BDA9F,0x81CAA8E9,0xF0590E6A,0x617412CA)
+  },
+  { /* P{6} */
+    W256(0x3FB6C284,0xF66ED55E,0xF6D47739,0x715C6C81,0x4777A2C4,0x708F73C9,0xD3EE5F02,0x06AFEE52),
+    W256(0x7C594242,0xC69BE817,0x2A8A5DE3,0x464B33D1,0xA775C488,0x62068238,0x41764526,0x69107308),
+    W256(0x167E9E98,0x4C32BFEC,0x8510D221,0xB2938F8E,0x0A77F3C6,0x6AC3C6DF,0x8929AC36,0x7887BF30)
+  },
+  { /* P{7} */
+    W256(0x9CB67126,0x5BE56CB7,0x8D7215EA,0xEE3C0BC8,0x2FD0A77F,0xDD47ACBA,0x718BD1D3,0x5EDE3304),
+    W256(0x655F9A20,0x623328EF,0x0BB89D1E,0x97738AA9,0xFBF2E93D,0x0B7B9C43,0x957261E8,0x68AFDC1E),
+    W256(0x1A15B11B,0x130E926C,0x912D7921,0x14C1B0A9,0x9F091785,0x2A3C4866,0xA31FF0C0,0x348A0231)
+  },
+  { /* P{8} */
+    W256(0x6EEF723B,0xBB6E994C,0x82E8DC84,0xFAC10332,0xE86C088C,0x3863BB80,0xBE2B128E,0x752FC30B),
+    W256(0xD34CB279,0x85C59674,0xAB7D3342,0x1EE0CB76,0x4A9DBDC3,0xCAC987D7,0x31745766,0x2DB989E9),
+    W256(0xEB37DA35,0x156E7627,0x87B8F7B6,0xDC145E09,0x00E461B1,0x96D23883,0xA25B9BDD,0x7F9A3989)
+  },
+  { /* P{9} */
+    W256(0xAE5A6544,0x7A98BAD8,0x3C1251A6,0x16601531,0x545FA2DD,0x180045A1,0xCBC365AA,0x078E4518),
+    W256(0x4E4BC57B,0xD59357F2,0x08C1176B,0xC91212C9,0x66FE9064,0xE8864E00,0xBC02F566,0x31EF592F),
+    W256(0x31F0CC55,0xCC3795B9,0xF9D76601,0x5E862939,0x668DC719,0x7D3180CB,0xE6314C22,0x78CFB46E)
+  },
+  { /* P{10} */
+    W256(0xF86738EB,0xC4B51845,0x91A61AA8,0x445C42C7,0xB8CC1CCD,0x976A89BB,0x6626504A,0x3106C85C),
+    W256(0xDA371582,0x65D60D70,0x469C42F7,0xA4F5DF17,0xE8264AAC,0x46D065F9,0xF0B38263,0x3FB2682F),
+    W256(0xDF9815FC,0x55314907,0x57A13B61,0x89EDFF8A,0xBF570451,0xB2FE61BC,0xC2B87114,0x0C2D5DE1)
+  },
+  { /* P{11} */
+    W256(0x918B2CE7,0x4FD024E2,0x8766A07B,0xA58E4EB8,0xF2CF89E9,0x1227FBEA,0xB79E47EF,0x64E4ADA5),
+    W256(0xF94CBD1E,0xDA263CDC,0x03A7541C,0xA17FD4B6,0xB3F6C187,0x94677A7E,0x6BB95BEE,0x2925A4E9),
+    W256(0xC0071670,0xBC620967,0xE8464F51,0xFF165BDD,0x35AE74E8,0xACFD7F22,0xCDA50E2B,0x5D1724EA)
+  },
+  { /* P{12} */
+    W256(0x175B46A6,0x46FE362E,0xEC9837D9,0x28956F51,0xF7AB443D,0xEAEDE94B,0x855283C8,0x0C7057F8),
+    W256(0xA739BC05,0x2E351C70,0xF191BED7,0x16AC3D99,0x6CA73726,0x834E9E9F,0x495A3831,0x0EFE487C),
+    W256(0x5D3F860E,0x37A401A3,0x956B725D,0x56D35FA3,0xEB323B64,0x05A0E371,0xC911223C,0x1F4E1F2F)
+  },
+  { /* P{13} */
+    W256(0xAD00EB65,0xFF81069F,0xFB05CA0A,0x769D5B68,0x7A408252,0xB244D8ED,0x541D8416,0x3E2B19A4),
+    W256(0x826B6EE0,0xA298057E,0x642F92EE,0xF5021D4F,0xF5DFF400,0x8E7BA22C,0xA675A3D3,0x713A53AC),
+    W256(0xD98CA7DA,0x1D3F499F,0xAAA36945,0x701EFBA2,0xBDC95238,0x849C4409,0x1AB329BF,0x730C5A09)
+  },
+  { /* P{14} */
+    W256(0x3C2C2F24,0x76AB88B3,0x151CF6E4,0x43A2689B,0xDED7B532,0x64484FE7,0xAA8BABC1,0x491F211C),
+    W256(0x28606752,0x84794FA7,0x5382126E,0x5CD2C7B7,0xDD9B7BC0,0xF13AC064,0x94855786,0x22DA8110),
+    W256(0xCE0A8498,0x612CC58D,0x3D1FBD11,0xFF71F2A4,0x614B05D9,0x4FA50A7C,0x4E6E39CA,0x573A74C4)
+  },
+  { /* P{15} */
+    W256(0x5B563CC7,0x5870D101,0x5044B6D8,0x024E49A1,0x2EA2BC66,0x157F8D90,0xEAA86FC0,0x1534FB18),
+    W256(0xC82A3F2E,0x9D3B6C80,0x8D418192,0x89F46570,0x404DCE81,0x30CF9A45,0x22EE40CC,0x54B479CE),
+    W256(0xB834D99A,0xAF686D38,0xA3DCEC44,0xDEE9ABB8,0xC536E1BB,0xCE901BAB,0xABDEE75D,0x192626AD)
+  },
+  { /* P{16} */
+    W256(0xD37A95DE,0x6751F1EE,0xEE48E052,0x5535C639,0x77797DF9,0x0FBB5824,0x9C74F6F8,0x3423FA60),
+    W256(0x1C2296DE,0x6BE89240,0x6F1EC488,0x6FA38B05,0x1BB5271F,0xB3D64386,0xF62096D6,0x5956C9DE),
+    W256(0xC88AA9EA,0x0A06B336,0x99BBA22B,0xEFC75D3D,0xD1E23DE4,0xE495216D,0x739C7C27,0x23A3AA28)
+  },
+  { /* P{17} */
+    W256(0x3A5F44C9,0xC3A32065,0x7686D781,0xF55F9B96,0xFCD3FE0A,0x4334CD2B,0x2F77213A,0x50C427E4),
+    W256(0x60705CFE,0xF1EC2FD6,0xE79FCFE3,0x34AD4236,0xB0BB4F23,0x713E4BB1,0x5E120230,0x700C6279),
+    W256(0x7E03825D,0x85E23C5F,0xAF6D4FEB,0x25AE2211,0xA6AEBB2C,0x44514E03,0xEFAF23BE,0x145A1AD4)
+  },
+  { /* P{18} */
+    W256(0xC93F308F,0x55B4CE77,0x98C5FA55,0x1BDAAA44,0xA694E22F,0x10F79CBF,0x3CBCB89B,0x025B34C1),
+    W256(0x4A96DAC4,0xD230F9E9,0x26E47866,0xB6BB820D,0x284A64D6,0xD196EB22,0x72911371,0x498026BD),
+    W256(0xA91D57DC,0x21EEC9B8,0xAEFE7C1D,0x723903DC,0x128F23B4,0xD3B81765,0xFCCF0A02,0x4AA4F7FC)
+  },
+  { /* P{19} */
+    W256(0xA440A417,0x543862DB,0x7E9E0737,0x35976765,0x37499DE3,0x76001087,0x6C2793B1,0x3E37CD25),
+    W256(0x9F4E077C,0x43112C81,0x0E64C373,0xFACE4D8C,0x423A03B3,0x7E0EDC29,0x14769788,0x78EC8957),
+    W256(0x30FD107A,0xA8128CB6,0x2D70BFF2,0x4C16CC50,0x5CBFDB32,0x561D3D1E,0xC78CA9FD,0x7DB1C0C5)
+  },
+  { /* P{20} */
+    W256(0xA3D1071F,0x7B0161B3,0x7632713E,0x065EB4E2,0x2541428B,0x499C80AB,0xE8BF7693,0x17281CE1),
+    W256(0x4F977BA3,0x8D7552F2,0xF9FCAD2E,0x1E8E6577,0x1AA74711,0x72750115,0x7AD4A3A1,0x74DC6532),
+    W256(0xA7213A71,0xE7F71F4F,0x55E62221,0x722C8992,0x58C23986,0xD5FB8772,0x06646694,0x646C3B18)
+  },
+  { /* P{21} */
+    W256(0xD4A2D1FB,0x22237923,0x9E93F023,0xC7DDD438,0x236796E3,0x541A0E2E,0x14C3317F,0x5DD38256),
+    W256(0x249DD69E,0xF9ACD92A,0xB5FAC7E5,0x042CE7EA,0x2FC6DEE9,0xA66E2193,0x8FD8BC73,0x1528D8FC),
+    W256(0x8F6B8B6D,0x24253DD7,0x752D52A5,0xF0F6B605,0x734FB7E2,0x7B7CBDC5,0x73496AD1,0x41C21D68)
+  },
+  { /* P{22} */
+    W256(0x1F8C6E6C,0x5DBA805F,0xF7E4E8B3,0x7C5C825C,0x9E6D4459,0xB3AEA15B,0xF838A6EA,0x18349F65),
+    W256(0x124E9437,0xF45C24CD,0x0707CFE4,0x93E08C59,0xB3AC3D77,0x0846BCC9,0xC6307164,0x09D1A647),
+    W256(0x22009253,0x271EEE7F,0xC5116D85,0xA6D3ABE3,0xD25313A0,0xC455CD1D,0x42D4A00B,0x732FE734)
+  },
+  { /* P{23} */
+    W256(0xA1F75781,0x2078C358,0xB1ED68AC,0xD664D3CA,0xDF339B94,0xF23575FF,0x52A52563,0x4617001B),
+    W256(0x808ECDD4,0x367EF02A,0x9315AB22,0x12B43F52,0xE4035FCA,0xA393D7D5,0x643874DD,0x0DB451C7),
+    W256(0xFF21A133,0xB106AD92,0x3C5EC8DB,0x8351A740,0xF2498514,0x2C8B9BD6,0x167142E7,0x094142D0)
+  },
+  { /* P{24} */
+    W256(0x22F9D902,0x88BA47BA,0x95ECB2D9,0xB3268EA5,0xC5B2A4CD,0x74A665B9,0x5126B170,0x7F869845),
+    W256(0x8AF66034,0x45F00F7D,0xD23D3BF7,0xFB4A293A,0x67A3DEE5,0xFCC44CCE,0xDAA60D68,0x02983354),
+    W256(0x4E323409,0xA9955FFB,0x560A643F,0x5C524805,0x36F3AA63,0xB9A5068B,0x0D655678,0x263C41E2)
+  },
+  { /* P{25} */
+    W256(0x63CAB99E,0xC37ED24F,0xD84105E0,0x63A0507D,0xE5EF36A5,0x5EE93E92,0xB83FC3FB,0x1256CD11),
+    W256(0xCEFC588A,0xC33FFC06,0xC46E3779,0x8B27D44C,0xDF7DD4A4,0xC7273D0F,0x1E955923,0x73F5723C),
+    W256(0x5D7D207C,0x218F9BA5,0xFBF4D510,0xFB72162E,0xFEEB7626,0xB13AF64D,0x69D997C6,0x0AB8756B)
+  },
+  { /* P{26} */
+    W256(0xE4743458,0xE4774E7F,0x85978E57,0xED2CC1C6,0x4131B0AD,0xDB8C018B,0xA99B0AA2,0x6EA3DD84),
+    W256(0x9DC4F8AE,0x86A20D1D,0xC167D1C6,0x8551F12F,0x26274A40,0x787B38C5,0x449B2E70,0x1E71A3A1),
+    W256(0x63512B48,0x4B97A20B,0x993360C9,0x2A8C2DFA,0x2B6432DA,0x93C50561,0x75C27B72,0x6FC511A2)
+  },
+  { /* P{27} */
+    W256(0xC500692A,0x6A73ED7B,0x44FB067D,0x934E9A48,0x94F6EA70,0x6C87E871,0x8F9E14C3,0x226141A6),
+    W256(0x9C4824A4,0x2E95F3D9,0xB0684014,0x7593705F,0xCBDDCEE8,0x9F40DE4D,0x19545F1F,0x073A7EAC),
+    W256(0xD60EA530,0xC2BC0CC6,0x9022CE3C,0x7660B6C1,0x406035FC,0xA6ECE2C3,0x6D8B15AC,0x1F45A3E8)
+  },
+  { /* P{28} */
+    W256(0xB2CA3C92,0x884EA8DE,0xEA443364,0x4422B697,0x1AE31811,0x6294FC45,0x4E269780,0x6B1977C0),
+    W256(0xB79EE765,0xBEE0A3E1,0x7FEC193D,0xC04532A1,0x64C0F687,0x3B376160,0xBDE1AE45,0x59C74AD0),
+    W256(0x0DE15DE8,0x50C7DAD2,0xA64FA323,0x61D65F42,0x1C9761B9,0x5645BD2D,0x6835A3B8,0x20052DED)
+  },
+  { /* P{29} */
+    W256(0x31CBE161,0xF7DE7C31,0x09020453,0xD56EB050,0x98CB457F,0x2133CA48,0x2758A201,0x40B43691),
+    W256(0x55B68CC3,0x1129DA25,0xAAC4BF95,0x5CACC988,0x9F935FFE,0x80087228,0xE18B8518,0x0FB88DB4),
+    W256(0x9BB406D9,0x53A05227,0x4843FDA9,0xEFCBBAEE,0x12088684,0x4057D07C,0x451077DF,0x30CD14C7)
+  },
+  { /* P{30} */
+    W256(0x77726202,0x04C42EEA,0x52550F77,0xE8AA899B,0x68CF49EA,0xA207E147,0x93EC14FB,0x2CD5B108),
+    W256(0x2BC620E7,0x94A2BC79,0xE191CFBD,0xC5459799,0xB11290C0,0x5F6C3815,0x3B8AF824,0x1A25D2E0),
+    W256(0xA5485DED,0x75F2E1EA,0x34E4113A,0xC6EA08D6,0x71485452,0xE46D163F,0x2A47E132,0x0E125657)
+  },
+  { /* P{31} */
+    W256(0x334F44D6,0x6E0AD1CF,0x851CC780,0x2A7032F6,0x40EFDAEE,0x1F4B23F2,0xB78A09BB,0x5218F54C),
+    W256(0x49842925,0x79F36B8D,0x017FB327,0xD87B3851,0xD0C05682,0x49A5FCBF,0x1056A0D2,0x3CAC8DAB),
+    W256(0x83A54593,0xA3457764,0xC4B1D790,0x2C86B8D9,0x7D71A6BB,0x196C03CE,0x4D3ADF7D,0x6D3C84DB)
+  },
+  { /* P{32} */
+    W256(0x053BC8FC,0x667F988A,0x04A97EC9,0xFAD4B6D5,0xCD70FBA6,0x303BC66F,0x7DF42A76,0x5D465A7D),
+    W256(0x0EB5B8CD,0x4F1F77F5,0x4A0A6267,0x9EFB7FBB,0x5BDEC806,0xC2B2C58B,0x71896A6A,0x7ADE7017),
+    W256(0xBB0EEC77,0xB1DDC702,0x446A4F30,0xCEC94114,0xB0590872,0x77193D06,0x6215A27C,0x44A38CED)
+  },
+  { /* P{33} */
+    W256(0xACB35058,0x93CD02FB,0x965BE4B4,0xB5A1191B,0x30B9A688,0x84486CF9,0x06F8400E,0x21C476C0),
+    W256(0x3CD562E0,0x794A647C,0x6C8D143C,0xAE330214,0xCD623EC6,0xBB9562F4,0x8F69F166,0x1CD44BBA),
+    W256(0xCF98F45A,0x3F24FA87,0x9982AF03,0xEE43B3E5,0x29C86919,0xDBC26A5F,0x88D8F52C,0x5F140588)
+  },
+  { /* P{34} */
+    W256(0x56048C17,0x8D03D14C,0x780579A4,0x53567514,0xFE3026A8,0x58B9631B,0x5608BE18,0x65F10E37),
+    W256(0x0F3370D1,0x043B5D53,0x2DFDBC1B,0x40540000,0x42D43CA3,0x804B85FA,0x79500EB3,0x53AFA180),
+    W256(0x10A1C2DF,0x9CDD7A22,0x37799212,0x29AE1648,0x54803387,0x597DB943,0xCA581266,0x0CCAA771)
+  },
+  { /* P{35} */
+    W256(0xEFAE3E4E,0x9A8CC11C,0x5501004A,0x9AD84AB2,0xC7B7FC61,0xC5D1BBA7,0x3EECC56F,0x11D45D3F),
+    W256(0x85AA8FB2,0xE11C09B6,0xC81627BD,0x87251554,0x07C36A79,0x08EA99BE,0x46DAC859,0x1B794D8A),
+    W256(0x69CC7880,0x6EBF5CA1,0x68044C15,0xBCBDE0CC,0xB527F8F4,0xB7062A20,0x3F74C6CE,0x513BDCF4)
+  },
+  { /* P{36} */
+    W256(0xA891DC83,0x414F39EC,0x9998718C,0xD26FB89D,0x217F3FD9,0xCC760DDD,0x226EEADF,0x5F095CEF),
+    W256(0x4B099FE4,0xE58D68C1,0xF01F3DFA,0xA4765E2B,0xE855EDF8,0x742F2510,0x7DD99D8B,0x19006AF7),
+    W256(0xDFDE7231,0x0FB4A28E,0xF3545CDD,0x0C77EF37,0xBE311BC3,0xACEC4D09,0x9FC777E3,0x04807009)
+  },
+  { /* P{37} */
+    W256(0x0480440A,0x9C367A6B,0x9183656B,0x70A63DCE,0xB7EE593A,0x87C41DD9,0x59641AEB,0x26C71FA7),
+    W256(0xDF75A5FF,0xAA2DC9EA,0xC7C628A1,0x398CBEDC,0xBDE1EDD2,0x97BB5CA5,0xB285C0DB,0x5E510E09),
+    W256(0x03092D32,0xF2091D87,0xB913EDAE,0xF520B96C,0x3FA74ED4,0x69AC0273,0x59C3B91F,0x73424B85)
+  },
+  { /* P{38} */
+    W256(0x0A7346C4,0x277D71C2,0xEDB1D7D1,0x84711700,0x81488132,0x2CBE2215,0xF0B0B647,0x4BDE9E6B),
+    W256(0x477FDC1E,0x363904B2,0x40C6D811,0xFD518EE4,0xA6F8D6A7,0x40D3F576,0x3607912E,0x61D04C66),
+    W256(0x4E1585FB,0xD8E3FCFB,0x2FBA09A8,0x812945EF,0x4CFC73AA,0xB2A56377,0xEDB0CDFD,0x37F3782E)
+  },
+  { /* P{39} */
+    W256(0x7A4E18CE,0x40F773C2,0x0DC84D66,0x72677547,0x39C74FA6,0xFB97F01A,0x6758E470,0x038A61A8),
+    W256(0x3DA21E88,0x53A9A149,0x0F346E95,0xBD42CE1E,0x46945425,0x00F876AA,0x212A915F,0x66742967),
+    W256(0x97B1A2C5,0x69D4FE8F,0xDE8F5CF4,0x2D5442AE,0x3C488BF1,0x0957D34A,0x7899307C,0x10EB7E19)
+  },
+  { /* P{40} */
+    W256(0x395A76FB,0x6316C33D,0x88F60C10,0xFCD92606,0x4D1AFC00,0x982EEFE8,0xCF7A07DD,0x66DE4AC2),
+    W256(0xB0D57A15,0xFF7115C9,0x85367C17,0x32488CC8,0x42192A80,0xADCB3972,0xF3D5F36F,0x46D9BFD9),
+    W256(0xBDB78817,0x92C2BF95,0x0D3EA38D,0xBAABAD4B,0x6DF327C7,0x5E40B9E4,0xF63DDBBE,0x642D8F64)
+  },
+  { /* P{41} */
+    W256(0xE943E89F,0xBEE9C980,0x0564FAE3,0xEAE61634,0x451DA9DE,0xAD3BE546,0xE11DF7C4,0x47AE08FB),
+    W256(0xC53D6DD5,0xADB86BD0,0x7B833B50,0x7041765A,0x8176D6A1,0x95A72789,0x8FEB4745,0x2F2FE7F4),
+    W256(0xA6B3D981,0x87DAA36F,0xB80BEDB9,0x523E556F,0x94098283,0x8BC718F7,0xE31B65C2,0x43242A67)
+  },
+  { /* P{42} */
+    W256(0x55CF16AD,0x47BA7543,0xA9C03887,0x8E35E1A2,0x5AB7404C,0x0CE89F5B,0x58777410,0x6D5C9498),
+    W256(0x3B1E778B,0x3759E405,0xD72C57A3,0x203AC54E,0xDED16204,0xED418110,0x2B2A90A9,0x2D69B743),
+    W256(0x64BEE06D,0x60DC0EEE,0xC5A117F0,0xEFEAA32C,0xD605223F,0x261AF6B8,0xCB81E920,0x254A5EB4)
+  },
+  { /* P{43} */
+    W256(0xE70BEA11,0xDE5BC982,0xDA5FA1AD,0x29762189,0xDD650E53,0x03783223,0x6E4AF1F5,0x2DAD8214),
+    W256(0x8EDB6E5B,0xF8E846D8,0x7461FA57,0x51038264,0x0BEE3AB9,0x0D6B44C7,0x4E08BBDF,0x4F947765),
+    W256(0x64D6420F,0xD90AA4A5,0xB01C1D2A,0xF91BB14B,0x7E672554,0xF73A8D0E,0x7AF10CD6,0x1D9A46A6)
+  },
+  { /* P{44} */
+    W256(0xCAE6797A,0xF797CA15,0x2E47BCDE,0x7A9DF50C,0xBF4D512C,0xA6A9C4D5,0xA9EE5B54,0x7A1785E3),
+    W256(0xA6E3B61B,0x39FE9813,0x7C1FBB8B,0xDC7939F0,0x0EAFD8A2,0x7138B538,0x56177D69,0x159FFA57),
+    W256(0x1C93DD0B,0x3AA0AA8D,0xD94F2A27,0xF7782F56,0x058DB323,0x9E975211,0x33B416CD,0x7D84912A)
+  },
+  { /* P{45} */
+    W256(0xB4405174,0x48B67547,0xBAAE15C8,0x0534EE32,0x0B663BA8,0x3D6CDB8F,0xA01556BA,0x5FB9BC01),
+    W256(0x6397D901,0x9367A342,0x1130B433,0x5D21C45D,0x336C24F7,0x368558B1,0x41E01D35,0x38FA882E),
+    W256(0x980FD6DF,0x033BA0D2,0xC2DF008E,0x0EA95946,0xB7C86EAF,0xBB045AF5,0xE0960975,0x4775E2BC)
+  },
+  { /* P{46} */
+    W256(0xD416C6FF,0x272E5047,0xEC499F35,0x740B92D1,0xC2C0E287,0x50FE5527,0x55B33A70,0x3C8F9FEC),
+    W256(0x011ACE25,0x3680FD5C,0x34F0CDC6,0x67C862C2,0xBF01E53D,0xEE4BE28C,0x44803EAA,0x73EF53D2),
+    W256(0x987D5CBE,0xEA26DEBC,0x49A5B212,0x2DBED704,0xDF233AF6,0x343D6A1F,0xCA49CAE5,0x26A207A7)
+  },
+  { /* P{47} */
+    W256(0xB7ABDE5A,0x15586A37,0xEAE74DC4,0x9B01947A,0x2EA82C9D,0xFA635F3D,0x77CCBE7C,0x0ED33932),
+    W256(0x219C7FBD,0x2B07A167,0x1FB4EECD,0xEFA2A005,0xE55E949C,0xDD5145BB,0xADDEC706,0x03B1E9D4),
+    W256(0x8A924567,0xF90927E0,0xFBA8DC9D,0xA556F546,0x3657360D,0x1BD52D59,0x24769943,0x0D72A559)
+  },
+  { /* P{48} */
+    W256(0x359EBBD1,0xA2726999,0x8134949F,0x5B50B5A6,0xA1EBE6AF,0xF4FF6FFC,0xA3FDB734,0x4C5161FC),
+    W256(0x7A013214,0x5BA60094,0x45C2FE8C,0x69E82533,0x00BD3C1F,0x083CE315,0x6658B411,0x07313BE5),
+    W256(0x1D28435E,0xC4D4C048,0x1ED7B25F,0xBEE7FF26,0x22724672,0x09AD8047,0x458D773C,0x7AE492C5)
+  },
+  { /* P{49} */
+    W256(0x4D2B26FC,0x79F0034E,0x64260E1B,0x22B9123E,0xC6A39944,0x6171B4FC,0x398621D7,0x122EBBCF),
+    W256(0xB9AF4785,0x2BBDBBB2,0x8D4C598E,0x8C845A3B,0x4D7C5B2F,0xA51A6042,0xD374171F,0x3350BED5),
+    W256(0xABB937DB,0x9A6678B9,0x82828716,0x83174339,0x79302AB9,0x7A71B498,0x429210F1,0x3170D712)
+  },
+  { /* P{50} */
+    W256(0x839CFE9A,0xA451D96E,0x64B8AAD6,0xCD55556E,0xD52FEBC8,0x2223B032,0xB8C4AF6D,0x484C7E95),
+    W256(0xDF208BB9,0x500321EC,0xDA8C86BB,0xDAB014BE,0x55381355,0x3C16F01D,0x73C20B40,0x6CE4C3AA),
+    W256(0x8FFEA89A,0xF1C54F8F,0xB09EE3AE,0x7BF8785B,0xE9BFD270,0x5F186557,0x0139F6D8,0x690C5DC4)
+  },
+  { /* P{51} */
+    W256(0x8E679659,0xACABC50D,0x9E620907,0x801D2A23,0x6B7CD7AD,0x02858772,0x2E02EE09,0x7ED3CE86),
+    W256(0xB11BC15C,0xF4B76944,0xBCE858FD,0x3BE55601,0xA9610C6F,0xEAB66FEC,0x4EA38BCC,0x0BFCB2D4),
+    W256(0x52AD7CC8,0x3EEBAFB1,0x97A46ABA,0xC9BDEE62,0x0A0A04A7,0xF93EE83D,0x6BFB54A6,0x495B74B4)
+  },
+  { /* P{52} */
+    W256(0x3C3DDA5E,0xD6F550C5,0xD9015977,0x0AB37E84,0xD3C3FCB0,0x3BB74444,0x9BB0DD0A,0x7E9D6F1C),
+    W256(0x59E4A5FE,0xAC17B564,0xEF92CD6A,0x768ED76A,0xEEABDDB9,0xEDB572EF,0xAAF22125,0x6CC27026),
+    W256(0xB0F84FBF,0x5BFBAEDF,0x8BE496EC,0x6C316FD5,0x4DAD72E1,0x31B9C00C,0x7A169F4C,0x6F1C996A)
+  },
+  { /* P{53} */
+    W256(0x125FB7FB,0xF142A7FF,0x39333870,0x013856AE,0x1BBAB1F6,0xB282875E,0x8B4B2143,0x7418D77F),
+    W256(0x48EB9980,0x645A53D7,0x527F4872,0x92EAFE90,0xBBA0207B,0x56D247A0,0xC4DCF123,0x162B5F68),
+    W256(0xF40D0DDE,0xB0CA2542,0x1960E01D,0x2F160F11,0xB9AB9A3F,0x8D712385,0x9C2093A6,0x3DDD8F3A)
+  },
+  { /* P{54} */
+    W256(0xC8B5E428,0x5DD96F1B,0x6250F0BB,0x52D50D0A,0x43294CC5,0x4F8C12C3,0x40758BF9,0x1C95E20A),
+    W256(0x158D461D,0xC70287E3,0xEEBF0358,0xED4DD934,0x97D11C05,0xD1C1B915,0xF8A8BABC,0x75C0BC28),
+    W256(0x27BB26FF,0x2B718CFD,0x6FCFB118,0xF5237899,0x77209906,0x12BBDACB,0x666613FA,0x445257CA)
+  },
+  { /* P{55} */
+    W256(0x1356A4FB,0x12BAB130,0x77B136E8,0xCC7CC226,0x58996533,0x9CB407B2,0x0AEB4A72,0x0808092C),
+    W256(0xA8A8CBF7,0x49617745,0x1E1AA17D,0x151FE7E6,0x51301838,0x046E2F04,0x7C8862B0,0x19DF5F91),
+    W256(0xAE64CFDF,0xED841BE3,0x9537F5B6,0xEE37636A,0x689A7052,0xFBEC874F,0xE3545521,0x67331031)
+  },
+  { /* P{56} */
+    W256(0x34CB25A3,0x949353B2,0x93B4DDBA,0x11E6AA4F,0x72607DB0,0xDCABBD6B,0xA3A010CD,0x61509F99),
+    W256(0xD4D42E34,0x8B9C373C,0x8E1385FD,0xD78AFFA3,0xDD936AA0,0xEE05407A,0xF1C17DE1,0x44685511),
+    W256(0xDD6E8402,0x47CDF4BA,0x1CDA7DA1,0x5E5D6916,0x429619CF,0x7B6D271A,0x5421DACD,0x0337C379)
+  },
+  { /* P{57} */
+    W256(0xB4C2AF1F,0x2EEA17FA,0x8DA7FBED,0x28B07AC5,0x37B8F36F,0x5E613493,0x8F2EEFC1,0x55165812),
+    W256(0xE41C4404,0x11765363,0x91B3B854,0xC61F84A1,0xF3BAC2EA,0x4616AD98,0x12416359,0x04F947B4),
+    W256(0xD7D314E1,0x1AAA1A04,0x5E811DAA,0xD2E604CD,0x9D80DBBD,0x77D8EBF6,0x61F2957F,0x6B776A44)
+  },
+  { /* P{58} */
+    W256(0x42E4CBF6,0xCF149A2C,0x0EDACD2C,0x22FAECF7,0xBBE8DA85,0x10F8FF02,0x691D9003,0x03FEF71F),
+    W256(0xE144A4AC,0xEE61A82B,0xD64F9B5E,0x0F8948E1,0xBAB8CA30,0x56ED6B9A,0x23361B12,0x2F597317),
+    W256(0x76D75F4B,0x2369C6E9,0xF5A607AD,0x17216992,0x06D004BA,0xA769D0E0,0x2CF5A5DF,0x0AF637C3)
+  },
+  { /* P{59} */
+    W256(0xCEB41D93,0xC129BDC3,0xB994C5BB,0x048A84C5,0x66F28408,0xD7293E95,0xAEA4BBFF,0x301017D6),
+    W256(0x96DF3F04,0xADB4B843,0x3DE12683,0x7963C0FC,0x7BC9F8C5,0xB7D245A2,0xA47BA353,0x794BBA61),
+    W256(0x5CF8ACDD,0xE518FB78,0xFBB11D35,0xDFA2182E,0x4B55C814,0x8E5E218F,0x35DA0B51,0x007BF754)
+  },
+  { /* P{60} */
+    W256(0x47A7F966,0x50314D42,0x70D85746,0xE1AEDD16,0x408EC282,0x20EADD31,0x5F754B3C,0x2D641D32),
+    W256(0xEBAC06B2,0xB17B5448,0x37576727,0xF6AA5CF2,0x3CE85556,0x7CD2E54C,0xCC55785B,0x7978FA01),
+    W256(0x47404778,0xC2482E87,0x90BE0D70,0x68DAFB1B,0xC16E3E14,0xD75F3F6B,0x5E60534A,0x6071C04E)
+  },
+  { /* P{61} */
+    W256(0x8159771B,0x30F98463,0xE693F987,0x2E5B38D0,0x8298E7F7,0x2D004C61,0xE22A071A,0x572A1286),
+    W256(0x309DDB42,0x2E4B292C,0xCED0D6AB,0xDD81B55B,0x716979DF,0x1A77423F,0x6DD66068,0x3F0DBF11),
+    W256(0xCE377272,0xD71180A1,0x323905E7,0x28B9C7A7,0x9510CD6E,0x25D67FE8,0x68C630A4,0x3BB4363B)
+  },
+  { /* P{62} */
+    W256(0x9CF55081,0xDF3DA1E1,0xFCA7870A,0xB7A921B8,0xFEB5B58E,0xDC5BED1B,0x05F82A6C,0x46D5160E),
+    W256(0xEDA32727,0x52D89D1E,0x5E2342B3,0x6716D17E,0xC031AE2C,0xF1655D35,0x8A64DF2F,0x1CD9D45F),
+    W256(0xC3BA34FE,0x4ED76403,0x85E33939,0x5B4FA94C,0x42F01DFF,0x84908472,0xCE0B8ADA,0x0B846D46)
+  },
+  { /* P{63} */
+    W256(0x0F26F8F3,0xD1E6D754,0xA7BF4CC3,0x50311822,0x53169D1A,0x4CC2E97B,0xA36C7AA3,0x6D9C40FD),
+    W256(0xA9D16FB0,0x5EF3D2BF,0x8F1C448B,0x3856AB2D,0xA5C2C095,0xB5209CCE,0xDA062AF0,0x61F59C2A),
+    W256(0x03C46335,0x2ADF9075,0x1922BDCA,0x82D4B66C,0x1A9B4DB0,0xD2CF06A3,0x192F8402,0x035578B8)
+  },
+  { /* P{64} */
+    W256(0xA48FF019,0xB93C6905,0xC83C9657,0xD78759CA,0x47B9AC48,0xB9CC5E7B,0x5E772B90,0x064AD70C),
+    W256(0x01C2744C,0x73F82B6D,0x01389039,0x722E77ED,0x28E8F541,0xD699D857,0x5DBB14FA,0x408E79DD),
+    W256(0xE0D88614,0xDF851B3E,0xA1DD19A2,0x6E5F4423,0xE154DDE2,0x1D9C3314,0xF3D7B7B8,0x5BAC601C)
+  },
+  { /* P{65} */
+    W256(0x3DBB1FDD,0xA5039EF9,0xE6592AB2,0xFD40D817,0x746B55E1,0xAAF27A9D,0x519A3995,0x18417C01),
+    W256(0xCFAB3E92,0x89ECB470,0xB5ECFB5F,0x445DF5D0,0xED998490,0x97FE0FAF,0xD7A644C4,0x70BB77BB),
+    W256(0x4074DBBF,0x68CFDCE3,0x4C32EBFD,0x38206464,0x5C954C0E,0xC2F5510C,0x6EC81022,0x667EA0F9)
+  },
+  { /* P{66} */
+    W256(0x298E04BC,0xA2DD1BF1,0x69EFD171,0xEA3E77B7,0xEB974CB1,0xFB2037F7,0x8BB84EA1,0x3636A84D),
+    W256(0x7C97EE73,0xEC59F11B,0x79B5D5E4,0x97D7BC16,0x1C17D526,0xF0FD0261,0x99860E9A,0x59DB61BA),
+    W256(0x7D442097,0x77B1567B,0xBB3C9A75,0x6796C5AC,0xD3CE6EAD,0x1AB36ED9,0x6A49BBA8,0x2D6335D9)
+  },
+  { /* P{67} */
+    W256(0xD9264A54,0x34569BEE,0x03E6E1B4,0xF48C97A8,0x9F3053A2,0x0DB5177B,0x325F6A2C,0x4066E704),
+    W256(0xA5B624B6,0x68E7A6BA,0x7C91C706,0x36BCEEF0,0x6F64B7D9,0xE88B72F0,0x039E6D04,0x22F0E5F9),
+    W256(0x9CEB5397,0x19B26954,0xAD6956EB,0xD863A9AD,0x3F47A67B,0x2E9C8B6A,0x456D25B5,0x5EB18D07)
+  },
+  { /* P{68} */
+    W256(0xE1599D48,0xDC72367F,0xB7244B1D,0x038E9604,0xC08C13F8,0x0D8A72BC,0xF09717AE,0x5115A530),
+    W256(0x5C257D16,0x9188F568,0x97F76868,0xF6FF653C,0x91BB1E0D,0x6E7C8B94,0x9BB31513,0x4056A7B3),
+    W256(0xCE7C17A1,0x6B31DCB6,0x1A3BD7EE,0x26E91E0E,0xA3A52B5B,0x0619B97A,0x60BB9B1D,0x3C44C495)
+  },
+  { /* P{69} */
+    W256(0x2F1DA15A,0xC0E95CAD,0x8D5E1455,0x80F7CC68,0xB28BF45E,0xBF37B105,0xDF549BC9,0x41198DC0),
+    W256(0x4279CB55,0xAA3CBA02,0x615FAD0D,0xFC2A416E,0x45D786D5,0xA0DB4717,0xD271E4EF,0x667BDA6D),
+    W256(0x4EB15FB7,0x03E7A083,0xDFAB130C,0xC635E5F7,0xC0AA382F,0xB6059302,0xF9D0B725,0x6D0328B9)
+  },
+  { /* P{70} */
+    W256(0x053A6FAF,0x07BECAF0,0xDD3A6145,0x78D20793,0x1F3951BC,0x59BCA321,0xB2E7B1BB,0x5739E64D),
+    W256(0x606E9369,0x0A6DB38A,0xAFC8103D,0x003C3194,0xE9D1900F,0xC11AE577,0x30BFF936,0x59D4C4E1),
+    W256(0xF1BDE769,0xB218C79A,0x5AD191AB,0x14171FBF,0xC52F95F5,0x2DCE64CD,0x68F99944,0x54DE3767)
+  },
+  { /* P{71} */
+    W256(0xCBA0CFC1,0x06504782,0xFBB5643C,0xA02B8BDC,0x78985915,0x5CD18C52,0x4D9B5E0E,0x7114B3CA),
+    W256(0xE4C4EDC0,0xDECEA60C,0x9212FE82,0xB031B910,0x6CEDDF5D,0x8603035F,0x73D9113B,0x42AF78BB),
+    W256(0xCF11E316,0x4BA1F0D1,0x1E7389D8,0x32299F2C,0x97BA0FB0,0xDF3CA7B0,0x39B6FE28,0x15052C39)
+  },
+  { /* P{72} */
+    W256(0x5107EB8B,0xD6BEAF51,0xFAD39D88,0xB886C5C7,0x5B96AF6C,0x1E5B2C61,0xFCB12ED7,0x5723BF02),
+    W256(0x94B03A32,0x01B6DBD1,0xC2AE962E,0xBB67B472,0x61268D5B,0x2073DB1D,0x60B43940,0x6FF23AB9),
+    W256(0x368A052C,0xD29FC400,0xE2E9F241,0xC9452CB4,0x90D57AC1,0x49192DD6,0x33DDE491,0x1B6F64AB)
+  },
+  { /* P{73} */
+    W256(0x8E213788,0x8266296F,0x18CEBDE5,0xE60FF4E4,0x26A41362,0xF79DBD3A,0xC0788495,0x6C3FD8AA),
+    W256(0x7DD3A75E,0x2222BC75,0xEBF6D34A,0xF3D66F61,0xD0A2EDD1,0xCFF3D9C5,0x37473643,0x7BCA9B34),
+    W256(0x2DE22270,0x2946BD06,0x54D161C4,0x9875FA7A,0xD1F546ED,0x2507F8D6,0x9C160A4D,0x55FF5863)
+  },
+  { /* P{74} */
+    W256(0x4BB6FFBA,0x069021AC,0x51AE2253,0xC6315AB6,0x64E42013,0x921CF1F8,0xE425EDDB,0x7165884F),
+    W256(0x3675191C,0x05446625,0x5E9BFBD8,0x423547C5,0x276EED77,0x295B621E,0x76A21598,0x77A311D6),
+    W256(0xBCDBF1C9,0x28112A4C,0x0A9F049D,0x7659F9F6,0x300D83B1,0x3340C0EC,0x9488656C,0x372E73E5)
+  },
+  { /* P{75} */
+    W256(0x3E837695,0x10F83B55,0xFFC26F70,0x71F8DF0A,0xC235BEF2,0x5DAA5D0F,0xBB3B11CD,0x1A7DBDFE),
+    W256(0x1ABBF222,0x02D8F179,0xCAF0DE8E,0x7BBDC0EF,0x9B7AB678,0x681722EC,0x1F0A5186,0x25A6E436),
+    W256(0x058424A5,0x14328996,0x26D0C1F6,0x85753FBF,0xA869C349,0x038F8F1C,0xD8B2B63E,0x46E65CD1)
+  },
+  { /* P{76} */
+    W256(0x7FC17F60,0x7EF8AFC5,0xFE2CDF33,0x63A128E5,0x7D46C365,0xC24EA9AC,0xD622393B,0x7AFEC240),
+    W256(0x22D45188,0xFDE9F809,0x3C97F862,0xF6A71285,0xD74F4494,0x3A290BDF,0x9983487F,0x3F44D1E5),
+    W256(0xACC5123C,0x5CAC7E68,0xAB1CBAB6,0xC35D49F4,0x99808B74,0xB2BC9CD0,0x1440D7BE,0x092FE579)
+  },
+  { /* P{77} */
+    W256(0x9BF25CF9,0xE7810621,0x9961A519,0xCB06468C,0xB5A4B12D,0xB6217E05,0x712D79A3,0x75781B08),
+    W256(0xCAA1D0C0,0x302660D4,0xB544D0C6,0xB95D60ED,0x2A1F6097,0xBCCB07A1,0xAB1BE964,0x1E582E5E),
+    W256(0xBA24FB74,0x17A6FDAC,0xDD001F61,0x2F6DFF23,0xC366E189,0x27D672AD,0xED6CF7A6,0x435582BC)
+  },
+  { /* P{78} */
+    W256(0x4BABA330,0xFD12CA7D,0xBF5552F4,0xBE69E70A,0xB21872E3,0x37442AE7,0x69598AAF,0x7E62338E),
+    W256(0x2E741F74,0x82A7249F,0x2DEC36E5,0x833E4166,0x30DB7A48,0xFA981D9C,0x87076C77,0x3B28097E),
+    W256(0x1478CB72,0x7F737689,0xFEFE1DE3,0x02F1C000,0xAEC8C02B,0x57A09F15,0x6CC87457,0x11AC1CA0)
+  },
+  { /* P{79} */
+    W256(0xF8FEF41F,0xD54EE573,0x563048BE,0x2AA84D9E,0x19046A46,0x880EA828,0x0EE16997,0x39B32266),
+    W256(0x7E650C1C,0x13C30B40,0x54E394A9,0x69FC98E4,0xF553BDBF,0x9754BD98,0xC0DD7955,0x6DB1E9F8),
+    W256(0x1C92CCF0,0xFACBEB41,0x8A0DD7BC,0xE295D9A1,0xAF795F7D,0x5150E7F6,0x918A4DB0,0x2E480641)
+  },
+  { /* P{80} */
+    W256(0xB3AC5EE6,0x49BBADFE,0x74528214,0x1ADAAC62,0x56314AFC,0x43B05AED,0x3B969B5E,0x7BF588DE),
+    W256(0xA8826909,0xF0D91598,0x10F184FA,0xF99A9F04,0x55A2900F,0x04382ACF,0x37145046,0x450E0956),
+    W256(0x4058C378,0xDEF4B4DC,0x876F45FD,0xE1DB5413,0x619A4C1B,0xE2435D56,0xBB24E9BE,0x38A39BB5)
+  },
+  { /* P{81} */
+    W256(0xB5FDDCFF,0x114524D8,0xAE500E68,0x1DA784AD,0x49DD3359,0x0E529F76,0x78BD4D88,0x33E3E737),
+    W256(0x7A340CDC,0x696BE1D2,0xAF281960,0x451BA49E,0x8F5D6FFC,0x1F0EC4C8,0x10D1AEAB,0x0E22E053),
+    W256(0xD736B58F,0x184F3C9B,0x9CB1E049,0xE8B63707,0xD0B8BAD2,0x4A37A5B5,0x7DC8E7CD,0x659F8DC8)
+  },
+  { /* P{82} */
+    W256(0x2A63F846,0x8EFC8394,0x3E4870F3,0x1ED36A60,0x4DF1C61F,0xC2FEB695,0x2CC09C4C,0x4F0A1C44),
+    W256(0xEDDFCFBE,0x16BF5442,0x3FD44172,0x63E7564B,0x98543A0D,0x33CD5ECD,0xD4A5DF4A,0x48EB4BFF),
+    W256(0x94391DE0,0xA2DF42A9,0x3B1F635E,0x0173FFBA,0xE28FAE46,0x6F2850A9,0xA37F7CB0,0x30A39978)
+  },
+  { /* P{83} */
+    W256(0xCE2DDE32,0x4471B918,0x1FEF1978,0x07BF9949,0x3A884F9B,0x47633C1F,0x98A31C6E,0x12184DB7),
+    W256(0xF54A0605,0x391F0912,0xCC4AFA94,0x5E3A3835,0xAA84B51B,0x4AD29D57,0x0C8EDBE6,0x0AC8D927),
+    W256(0x7FE60AB7,0x7175A1EC,0xB86D75BA,0x23F6B1C3,0x3A3C25D1,0x49884BF2,0x89312A69,0x1BD891E3)
+  },
+  { /* P{84} */
+    W256(0x5DD42155,0xDC0F5C1B,0x105AAF8E,0xBD0D3354,0xB886888C,0xBEE30971,0x46D7E128,0x6BB56336),
+    W256(0x10311CBB,0xF57AF4AA,0x8F3A08F2,0x5266D952,0x890A2D07,0xCC5FBE20,0x6DA20344,0x5D57574E),
+    W256(0x94429EAE,0xD1CD08FA,0x88CB0C83,0xD0E5B84E,0xF69C58D6,0x52F8AAF7,0x2D4B1E7C,0x6808C567)
+  },
+  { /* P{85} */
+    W256(0xC9DE46C1,0xEECEBE0D,0x237A63D9,0xC1A69AA7,0x7AF1F6E8,0xECB69053,0xEF825C35,0x093CBB1E),
+    W256(0x06040931,0x260FC096,0xEE8C796B,0xEAABC7FF,0x10956BB6,0x08D3E87C,0x6D1AADEB,0x42082684),
+    W256(0x2518E955,0x4BDE7B1F,0xF1119887,0x5CEC2FB5,0x7726DBCC,0x0188535A,0x55BE689D,0x7D83CC81)
+  },
+  { /* P{86} */
+    W256(0x4E8E5CD4,0x461F4908,0xD296AFE5,0x36175534,0x6058038E,0x520FE149,0xB1E8CAEF,0x3329F865),
+    W256(0x1B078CC4,0xBCFFB990,0x3A709180,0x8363C59A,0xE6DFDDB3,0xBE831BB9,0x753B8C1C,0x634A0821),
+    W256(0xBD3E3288,0x70483201,0x57685672,0x548E7B09,0x8E15A7F9,0x26E7EEE3,0x22E6911C,0x249A71C3)
+  },
+  { /* P{87} */
+    W256(0x08044BB3,0xD219F0BC,0x9E97837F,0x211575A8,0x764AEF97,0x02736F41,0xDE03FE74,0x484414AC),
+    W256(0x8A87D7EB,0x19C34A6C,0x88E15472,0x1C9D1068,0x19F2BCEB,0x40BF1CD5,0x2E5D813A,0x7950B56C),
+    W256(0x825EDF39,0x100D0F57,0x0461FC09,0xBFD9DC9A,0x5A4967DB,0x7B13B525,0x1444A5E0,0x7C3BB79E)
+  },
+  { /* P{88} */
+    W256(0x6D4F916B,0xCFDD5279,0xAD0B2E28,0xEAD6D17F,0x99AE0C95,0xF64BB75B,0x042B1755,0x098B5D5D),
+    W256(0x025DE465,0xCF5DB50D,0xBFC0C82E,0x346378DC,0xC75A9454,0x642F77A0,0xDD74E6CF,0x6B5B9B15),
+    W256(0x3E66C7D5,0xA2D18337,0x129836FF,0xD2F5635B,0x4B9B644C,0x5EB22DFE,0x978DB416,0x38B7E5BA)
+  },
+  { /* P{89} */
+    W256(0xFD87D2F6,0xC7062549,0xD2623F36,0x9867AE21,0xF21C66B8,0xB1A24BD8,0x92D52F7B,0x2FEC4E07),
+    W256(0xB311D42B,0x9371BF11,0x0C36ECDF,0xDC940EBE,0x5A3C3406,0xD1CD1376,0xE577BD66,0x734B9FA1),
+    W256(0x978D838B,0x595AC022,0x5B5A1428,0x67D9FF86,0x607A5C10,0xFD89115C,0xBE5B6D61,0x441E95A0)
+  },
+  { /* P{90} */
+    W256(0x9138C9F1,0x9E631763,0x39F9E55B,0x3B8017B7,0xFA0D08EA,0x76CF25F3,0x0132CEAE,0x28FD6CDA),
+    W256(0xC2CBFE65,0x984B6C15,0xAA8689C8,0x3CAD4502,0x0A90CAD6,0xBC7926D3,0x9337A0A8,0x0538589F),
+    W256(0x34B620A7,0xA16672C7,0x3324828A,0x1ECDA7CD,0xC18D017E,0x11B4937F,0xB1CBB44E,0x54C2F712)
+  },
+  { /* P{91} */
+    W256(0xA95EC7D9,0x3A28FAAD,0x3D229F04,0x353CEE1E,0x6D22EE76,0xE7EEAEA5,0xE771B1F4,0x646B6953),
+    W256(0x14AC2EB3,0x5C4D08E2,0x86B6D271,0x43F03960,0xF2B0AFD8,0x6A387AE5,0x22F2E401,0x35699D4E),
+    W256(0xDE9E839A,0x95D8DBB2,0x568780DE,0x9C812EB7,0x384334A3,0x60027368,0x1FA95540,0x76BC55EB)
+  },
+  { /* P{92} */
+    W256(0x90A8E377,0xE7FBC609,0x3766B2B8,0xFDE43D59,0x09011BA1,0xC1C68605,0xB5A40641,0x5E6664C8),
+    W256(0xB95BB32E,0x2BC3C930,0x4F87419F,0xF9BE764A,0xB12A76B4,0x7BC64FFA,0x400CAB16,0x576A1CC0),
+    W256(0x2D9C8712,0x6E0D2753,0x8BAE0F0C,0x9DC33162,0x83CC8163,0x3E7DDEF8,0xE9DDFA83,0x079644BB)
+  },
+  { /* P{93} */
+    W256(0x1A5E4512,0xF03029D9,0x96917DAA,0x13700AC4,0x7C9FCC99,0x428F5DB3,0xB80D158E,0x60F5CA48),
+    W256(0x9CF3EA46,0x4EE19839,0x43A6923D,0x09C2EB90,0x29925F7C,0x97B71153,0xAAD7C894,0x1C6F1798),
+    W256(0x0EB8DEF5,0x8EC8E417,0x3F579DBC,0x0D98F7AD,0x0012A844,0x0F3DAC9A,0x1E2B23A5,0x47639DE2)
+  },
+  { /* P{94} */
+    W256(0x5880F00C,0x4D9C21EC,0x5C543A2D,0x05EC4B54,0x878C7CB0,0xBB58A527,0x62BBAAD2,0x6E07A021),
+    W256(0xAB6B04A5,0xE4DF5A47,0xA4E00E39,0xC43B070E,0x03CD91AF,0xD3B6C228,0xB004AFDB,0x2682683E),
+    W256(0xDE84C2F0,0x5DC55837,0x3638BAC1,0xBB8EE5E4,0x9B9D9894,0x658022D8,0x33C03E15,0x2FBF3DE7)
+  },
+  { /* P{95} */
+    W256(0x41D51C98,0x0AB18C0F,0x88139112,0xBD45CD38,0xC1CD4405,0x8CD0293F,0x8D2D3E8B,0x3C819D71),
+    W256(0x7C50D2A0,0x23E9460A,0xFBA2F9C2,0x65F24959,0xA40CAFD7,0x9535CA1A,0xC0BD9620,0x563C3FF1),
+    W256(0x60716987,0x8B759D6C,0xAF32A08C,0xA736D253,0xB82C1F38,0x43644400,0xE8A8E327,0x7926378B)
+  },
+  { /* P{96} */
+    W256(0x7473B904,0x45160B89,0x37822889,0xA6E2B753,0x030ED5F8,0xF857C650,0xB0FFFE4F,0x59B300DE),
+    W256(0x85167182,0x34FBCADD,0xCE9DA531,0xF967966C,0x2C5C2218,0xEF53DBA7,0x8A776B85,0x5EB64AF7),
+    W256(0x557CF7F8,0xC79105EF,0xBEFD6753,0x47DC93A9,0x197C41ED,0xB23CD56B,0x81615C29,0x6CE6C8A2)
+  },
+  { /* P{97} */
+    W256(0xF93167A3,0x7F7E22F8,0x9F55E941,0x8276B703,0x2D0B328E,0x40CFDABD,0x7480F935,0x1B588C6A),
+    W256(0x64C2CC79,0x7B22887A,0x1BDCB83B,0x84B6B6B4,0x4DA40576,0x97D2F31B,0x9E76BBDB,0x107DD134),
+    W256(0xB9687A75,0x7AE10FE3,0x7D3F4A18,0x004479C8,0x6E4B5385,0x76C73639,0x89CA7237,0x110FAEB7)
+  },
+  { /* P{98} */
+    W256(0x7EA45B05,0x235A3638,0x1855055B,0xCEA986B6,0x01BBAE85,0xB27BB743,0xAD147A66,0x7D1AE234),
+    W256(0x655EB646,0xAD27E5CE,0x74C99C0E,0xB5F15E59,0xB3D407A1,0x33A41070,0x458C4571,0x5893065D),
+    W256(0x412B7852,0xEA683904,0x767E3B21,0x9841A2E2,0x5749D6F0,0x5E8D2647,0x637F2E52,0x433DC55C)
+  },
+  { /* P{99} */
+    W256(0x73DCBF72,0x2D2A6A76,0xF4EA7C30,0x162908FB,0xE6FE6632,0x81C603A7,0xB0D22157,0x6E8C2296),
+    W256(0x90B3201D,0xBA55C360,0x1B6D288A,0xA7D4FADF,0x49B27C36,0xCC0268F9,0xF5A8A7CB,0x3DB8F1B8),
+    W256(0x517D38F1,0xBC77E6E3,0x2946A33C,0xD38870D3,0xB545F68D,0xBF1106B4,0xFEF9E20E,0x360AC932)
+  },
+  { /* P{100} */
+    W256(0xE42C62DE,0xB204B4B8,0x09C3EBE6,0x7F524758,0x89185701,0x2BE7AED2,0x27CC4949,0x03EEDA95),
+    W256(0xA6617DA9,0x1E1DBF42,0x4CDC4AEF,0x8D235FA4,0xCE28677F,0x8660AB50,0xF334791C,0x33A0249B),
+    W256(0xDAC021FC,0x1E54E70F,0xD9789B5E,0xB51B7C27,0x17F77AFC,0x5872AB60,0x08FC9951,0x1471046C)
+  },
+  { /* P{101} */
+    W256(0x47CA3D04,0x5BBB33D1,0x73B97734,0x033E4CBC,0xCDE32F34,0xFF28DB78,0x7E7D29AE,0x374B1513),
+    W256(0xD96CEDF5,0xFB85E03D,0x893985A9,0x1ADD4C0E,0x3C6A0E36,0x7E1C3E75,0x09547AB7,0x5E1B11B4),
+    W256(0x3CEFC6E6,0x8CEBF522,0xD6C827C8,0xA98187C0,0xAA16EC1C,0x0B819E9E,0xA879BFC4,0x657234F8)
+  },
+  { /* P{102} */
+    W256(0xDBF3E0D2,0x42175571,0xCADD76E2,0x61EC9630,0x69BF5F77,0x8F34E037,0x0DF3FF40,0x2EC9E91F),
+    W256(0x9C880433,0x02F28309,0x563C3137,0x1AF14F5C,0x6C30E36C,0xD7C7D441,0xF97CC00A,0x31683ABC),
+    W256(0xC1812119,0x33ACB419,0xD5C1ED50,0x558D0EB6,0xAD4D57F7,0x954BD079,0x7B2774A3,0x5040F386)
+  },
+  { /* P{103} */
+    W256(0xE7027432,0x8FAF6927,0xDABD9ED3,0x51E51E0D,0xFC4354CB,0xF56D421D,0x7760633E,0x59A43BEF),
+    W256(0xA22D65D0,0xEDA923C5,0x8D035BEB,0x79C01A39,0xCEEE9AF5,0x0C354CC2,0x6D4FC848,0x2B8D83FA),
+    W256(0x0958BEBC,0x0240ADA2,0x6706CFAF,0xBC0405DD,0x52E0B023,0x9EC77D48,0x6322250F,0x41AE70DB)
+  },
+  { /* P{104} */
+    W256(0x666F11A8,0xB9A825E4,0x51875EED,0x3F3D54C5,0xB3B66891,0x12D8441E,0xE5C25421,0x084E6BC2),
+    W256(0x10756720,0xF077FAF8,0xEEB8F39B,0xB85016A0,0x6B7BBC88,0xCC1122EF,0x764BB94D,0x3F6C0C4A),
+    W256(0xE679848E,0xD59C373D,0x7784DBD4,0xEA2D7FC6,0x31A13E11,0xE29CC62B,0xA8D8747E,0x12635B8E)
+  },
+  { /* P{105} */
+    W256(0x42081576,0x81142A64,0xB1B69507,0xDF53C2F7,0xDFBAEC83,0x06CCF145,0x6F067B2F,0x25C994AA),
+    W256(0x7A24F47A,0xD5996901,0xD942F7B6,0xF5397B19,0x653FADEC,0xD83BB2B3,0xC77509C0,0x2726523B),
+    W256(0x2A7322AB,0xB4A136C0,0xE368837D,0x05B7EF6F,0x81DDDF7D,0xEDFA9174,0x8C160E2B,0x0E63C060)
+  },
+  { /* P{106} */
+    W256(0xC07E094F,0x15D12172,0x87B0D6C1,0x23ADB6D5,0x6D405E8B,0x18E8CB31,0xE79045FA,0x032A242D),
+    W256(0xBEA70BFD,0x900349EC,0x18812A48,0x2610B209,0x7EC1B92F,0x28D9177A,0x7A6E2FC0,0x23F587D9),
+    W256(0x925EB373,0x4B491FC4,0x610F5F65,0xFFFF4118,0xD0760FF9,0xD693B4C3,0x9A07E61F,0x34A82822)
+  },
+  { /* P{107} */
+    W256(0x36EDBBF7,0x6B8F91BF,0x8E9778DC,0xB156A22C,0xA62E9585,0xD94CD294,0x10FE5E4C,0x1A8C71D0),
+    W256(0xF7B23118,0x6FCF98FF,0x235C3D20,0x0ADE3BE5,0x86A44737,0xD66D728C,0x54EB6CF2,0x10ABC36B),
+    W256(0x0B16FEFE,0x220DC043,0x7754B588,0x33675950,0x5E8D78DC,0x26585119,0xBD734D44,0x2DD82E0E)
+  },
+  { /* P{108} */
+    W256(0x2A001BF4,0xC5EB082F,0x1067346E,0x7EDDDAF5,0x92278C69,0xB2E54192,0x1E8774BD,0x0AE24863),
+    W256(0xE7B40365,0x64C7F342,0x18044FF0,0x7F900A5D,0xE5628886,0x19C5B65C,0x3CB1BBC7,0x2D5A4179),
+    W256(0x16DFE501,0x4CF73718,0xC54B8600,0x6FC54C14,0xA67E9C60,0xD274DF7C,0xA309F502,0x2EE47033)
+  },
+  { /* P{109} */
+    W256(0x8323062A,0xFC48659A,0xCC6453F2,0xD381BA92,0xA3846062,0x1C142793,0xD93BF392,0x36131C06),
+    W256(0x53B707FE,0xE07B041D,0x58006847,0x11E88A39,0xB0081EFB,0x96B4ACFA,0x9E02DA34,0x5FC5F3D3),
+    W256(0x40B50701,0x06024CD6,0xD5E5F9A7,0x4CF49754,0x711DFB17,0xEAA26E45,0xE62B9FF2,0x7EF47537)
+  },
+  { /* P{110} */
+    W256(0xE19425A1,0x76223AC2,0x6E18B2C9,0xAD88FABD,0x4E60C9DE,0x2130BAE5,0x75524CEC,0x1F8015A8),
+    W256(0x7CB2C776,0x6D3E1584,0xA4FB3CC9,0xE4FCA192,0xFD57764C,0x143190BF,0x41003608,0x40844D53),
+    W256(0x9263A8C0,0xAD4D6C6A,0x72C40262,0xBD4F6ABC,0x06706764,0xC2B3AAF6,0xB6AAAA03,0x068DF877)
+  },
+  { /* P{111} */
+    W256(0x31239F1D,0xA1EFD345,0xC921867C,0x7EFE2BA4,0x5FDE57FB,0x944A7E41,0x7CDA5F19,0x07D0CA1C),
+    W256(0x718607FF,0x09434DBE,0x0E479B65,0x82083F20,0x958B126D,0xF1520BAF,0x8D8D5401,0x3A7F5096),
+    W256(0x1E887A89,0xD1F99EA9,0x7679BBDD,0xB7735259,0xD1780E51,0x282133D4,0xB018B1CD,0x3079ACD0)
+  },
+  { /* P{112} */
+    W256(0x4B5D658B,0xD12C404A,0x1EE1F272,0x41C2826B,0xD35016BD,0x870ACF78,0x13FFC7D9,0x2F5C0E3E),
+    W256(0x621B63F7,0x824507DD,0xC3E76C41,0x2FD7CB1C,0x0293552C,0x539E8528,0x57228BA2,0x5ABED4BF),
+    W256(0xB10325D9,0x2A63FA17,0x8C37B0F2,0x3933391A,0x22CAECF2,0xB89F0D83,0xD68FAA60,0x46F8C1D8)
+  },
+  { /* P{113} */
+    W256(0x61EEEF55,0x87CA052E,0x642D117F,0xA89DBE11,0x0B62BCC1,0x86A3486B,0x3390C5D1,0x00BD47F6),
+    W256(0x975DDFA0,0xAB6014DB,0x20A74AA8,0x0D3DF180,0x64F8F6F8,0xB8CA95C5,0x769D0BA8,0x03FEB108),
+    W256(0x1C3EC323,0x6DC3C37D,0x8D76B523,0x2A48DB19,0x305729E4,0x7950BEF2,0xC385F247,0x7F0A2398)
+  },
+  { /* P{114} */
+    W256(0xB0F241E0,0xF5FAEC30,0x70498DB6,0xD6AA8683,0x5E590985,0xD506E9CE,0xF74A5289,0x2B10BB5B),
+    W256(0xC731315A,0xB4DA5955,0x3B83B4A7,0xCCC0E2B6,0xF74AB527,0xB82022F9,0x411F965B,0x525B0655),
+    W256(0x6D54ED23,0x9E44E4A9,0x84C12A2F,0xADEE410B,0xB38E60E1,0x1820021F,0xEF76A3C7,0x20882EF1)
+  },
+  { /* P{115} */
+    W256(0xF86934E6,0x86C14BC2,0x961DF124,0xFEDEFDA7,0xEF307D5B,0x538CA2D6,0x5F881ADF,0x21838BE8),
+    W256(0x2D8CCB8B,0x037F1206,0x8ACA096F,0x5923E33B,0x8EC4BD71,0xD407B956,0x3BC088FE,0x22C775AB),
+    W256(0x0D9A0E85,0x9C171647,0xFD56EEA5,0x86D957A3,0x40A61763,0x21D03082,0x4006FB1A,0x18FE8298)
+  },
+  { /* P{116} */
+    W256(0xA327E602,0x463049D2,0xD79A0E63,0xAFD39DE8,0xC10EA192,0x73C153E3,0x08FF0052,0x7864A31E),
+    W256(0x5C058E54,0x11C9CCCE,0xB35B339B,0x3091541E,0xF00867DD,0x00DC2459,0x3FA6B7FB,0x6297064F),
+    W256(0x81057FE2,0x64977F4D,0x57C06DC9,0xB9552BBC,0x9E211285,0x17D94FEA,0xE34810E9,0x019AC4C5)
+  },
+  { /* P{117} */
+    W256(0x08D98712,0xB233F73C,0x0F06B2B6,0x3ACCBFC1,0x8C688A60,0x1947F251,0x39C36415,0x3E4D00DE),
+    W256(0x1E190374,0xC6D0D4B3,0x7B67EAC0,0xE87B5C02,0xA0346EBC,0xBF34472E,0xBAEEF1C0,0x3B9BAB86),
+    W256(0x609E2E51,0xF55AD45D,0x70D6699E,0x74251488,0xB5B17E46,0xCDEE6566,0x10B1A403,0x50F62222)
+  },
+  { /* P{118} */
+    W256(0xF49F0131,0x224C171D,0x7B62F419,0xF43A0388,0x85383429,0x6CB3868E,0x4082DB90,0x1B0A7674),
+    W256(0x812F7E4A,0x260DD80C,0x1C7C670C,0x012C8F51,0x19F1E6B9,0xEFBFBAFA,0x8EB8E05F,0x59F2F78A),
+    W256(0xEABB3538,0xA60F1CA6,0x36AE5C88,0xFE50D68D,0xA9BCF12B,0x6FE836D0,0x6FD908A8,0x6821019D)
+  },
+  { /* P{119} */
+    W256(0x888CBA88,0xECD683D7,0x0F26F8E5,0x554FF8FB,0x1A60BCA7,0x61635EBB,0x7B3D7D5C,0x21D6FF06),
+    W256(0xBF5C00D8,0x4A280E90,0xE2851741,0xF5605218,0x3708DD6B,0x2017B051,0xFC9F59FC,0x6C89BC81),
+    W256(0x4FF1772A,0xCDE0679B,0x40E5A60D,0x582481C7,0xFC34591C,0x78DEEB71,0x7575250C,0x527FEEBF)
+  },
+  { /* P{120} */
+    W256(0x42E5DA14,0xCDEADBFD,0xD555A5E6,0x04A757E7,0x14840CF0,0x52FE41FC,0x4597D51D,0x1EB8C9A0),
+    W256(0x188842F0,0x97C21766,0x0D47E4C1,0x50821095,0x9C446F4B,0x78C15848,0x53D0E95C,0x21424AE9),
+    W256(0xA8F1C053,0x2102EB5D,0x739D9A9B,0x5CFE75D6,0x06FB3F26,0x9C368574,0x45841257,0x76C78EFA)
+  },
+  { /* P{121} */
+    W256(0x16CF4420,0x91F45FB3,0xD5382C96,0xF54C5DAA,0xC93D6486,0x974A28EF,0x7ABB2F17,0x1FEE2693),
+    W256(0x34EC6F5C,0xA9663096,0x276E3E84,0xFCC8DFB5,0xB29D8E7B,0xB7FD4D74,0xF346AF7D,0x6A426620),
+    W256(0x911192E5,0x04E88FD6,0x06F47178,0x42C95229,0x461FFDB6,0xB5CDC3F0,0x3FA59207,0x774D4FEF)
+  },
+  { /* P{122} */
+    W256(0x1D0862BA,0x1730CEC3,0x285F9B6C,0x4A3A21ED,0xC4E9FC12,0x9B6FDB5C,0xBFF2561A,0x6CD9FCF6),
+    W256(0xCE0207B5,0x1A643A40,0x86046D20,0xA2B1EE60,0x87AC35BE,0x3EF239FD,0xBA816E36,0x2916BB10),
+    W256(0x403D705D,0xDB145FAF,0xBD8524F9,0x53B8FE6E,0x7B0AACF6,0x4FA7A449,0x4B12CC1C,0x2B1774A2)
+  },
+  { /* P{123} */
+    W256(0x08F24171,0x5C478453,0xD76C7293,0xC559514C,0x9F208288,0xA308B7A9,0x46C4D898,0x5FF6A641),
+    W256(0x83EAEEE9,0x174CB21A,0xA4A229B8,0xCD24DAE6,0xE30CF826,0x7E5DF211,0x901940A8,0x218C5697),
+    W256(0x5E6E0CDB,0xBC5E6602,0x8DAE39DF,0xD1DDF421,0xD4D01932,0x35B0C97B,0x2A3A19AA,0x2827A034)
+  },
+  { /* P{124} */
+    W256(0x41AC54DD,0x55B4BE94,0x304E702A,0xC6FF9282,0x62018084,0xE28D5AC0,0x70116A9F,0x4C8B15DF),
+    W256(0x081C0D03,0xEBD352BF,0xBE11F2F4,0x2CAD8EE8,0x0D8E78AE,0x0FB6111C,0x91D544A2,0x0D2F28FF),
+    W256(0xA499DA12,0x2980EA47,0x7E21D920,0x1107E610,0xC5832E4B,0x2EF4D716,0x22B1B60F,0x5AD8A2C7)
+  },
+  { /* P{125} */
+    W256(0xDEC7B70B,0x6553B28E,0x5D1F7663,0x5060E10F,0x14B85729,0x918EECB6,0xC9BC35CD,0x30B412EB),
+    W256(0x10D11398,0xA2004357,0xF7C3494C,0xAA472FB9,0x7F7636CD,0xC600AC1B,0xD0A714DF,0x0E016CF7),
+    W256(0x87E632E7,0xA88E6C7B,0x551DF5D3,0xA5E853DF,0x417F3E61,0xEDE102E3,0xC6338F51,0x1EE5176D)
+  },
+  { /* P{126} */
+    W256(0xF2177E7F,0x161BC99C,0xFBE4339A,0xB5495C8A,0x60FD3C6D,0x7107442E,0x50E0D76C,0x53438990),
+    W256(0xB382B84A,0xAB180A2D,0x98677943,0x4202F883,0xD9F5FC9C,0xD44CCBB2,0xE963C6ED,0x511963D8),
+    W256(0x8F80B17B,0x5E8A8893,0xAFFB5B76,0x135D9F47,0xA8D3538A,0x6E9D656C,0xF2E15DA5,0x0BE00BD3)
+  },
+  { /* P{127} */
+    W256(0x94BB6B90,0x9E2B2EFB,0x4A6A3FE1,0xF5D4C66E,0xD578B4ED,0x82AF5828,0xA6068797,0x6793D1AF),
+    W256(0x8AF07244,0x9A55C9C6,0x41DD90A4,0x867F3F98,0xF66845FC,0xD4894F77,0x414914D7,0x2D01687D),
+    W256(0xD61358BC,0x61F36185,0xDD3DD058,0xE51BD50F,0x6C1A8B59,0x13D47700,0x98B5A8BC,0x16C7949A)
+  }
+};
@@ -65,6 +65,28 @@ void ecp_MulMod(U64* Z, const U64* X, const U64* Y)
     ecp_Mod(Z);
 }
 
+#if ECP_SMALL_FOOTPRINT
+/* Return out = 1/z mod P */
+/* Same addition chain as below with four temporaries instead of ten */
+void ecp_Inverse(U64 *out, const U64 *z) 
+{
+  U64 a[4], b[4], c[4], t[4];
+
+  /* 2 */               ecp_SqrReduce(t,z);
+  /* 9 */               ecp_SrqMulReduce(b,t,2,z);
+  /* 11 */              ecp_MulReduce(a,b,t);
+  /* 22 */              ecp_SqrReduce(t,a);
+  /* 2^5 - 2^0 = 31 */  ecp_MulReduce(b,t,b);
+  /* 2^10 - 2^0 */      ecp_SrqMulReduce(c,b,5,b);
+  /* 2^20 - 2^0 */      ecp_SrqMulReduce(b,c,10,c);
+  /* 2^40 - 2^0 */      ecp_SrqMulReduce(t,b,20,b);
+  /* 2^50 - 2^0 */      ecp_SrqMulReduce(c,t,10,c);
+  /* 2^100 - 2^0 */     ecp_SrqMulReduce(b,c,50,c);
+  /* 2^200 - 2^0 */     ecp_SrqMulReduce(t,b,100,b);
+  /* 2^250 - 2^0 */     ecp_SrqMulReduce(t,t,50,c);
+  /* 2^255 - 21 */      ecp_SrqMulReduce(out,t,5,a);
+}
+#else
 /* Courtesy of DJB */
 /* Return out = 1/z mod P */
 void ecp_Inverse(U64 *out, const U64 *z) 
@@ -137,4 +159,5 @@ void ecp_Inverse(U64 *out, const U64 *z)
   /* 2^255 - 2^5 */     ecp_SqrReduce(t1,t0);
   /* 2^255 - 21 */      ecp_MulReduce(out,t1,z11);
 }
+#endif
 
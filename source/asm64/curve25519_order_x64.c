@@ -69,10 +69,37 @@ void eco_MulReduce(OUT U64 *Z, IN const U64 *X, IN const U64 *Y)
 {
     U64 T[8];
     ecp_Mul(T, X, Y);                 /* T = X*Y */
-    eco_ReduceHiWord(T+3, T[7], T+3);
-    eco_ReduceHiWord(T+2, T[6], T+2);
-    eco_ReduceHiWord(T+1, T[5], T+1);
-    eco_ReduceHiWord(Z, T[4], T+0);
+    eco_Reduce512(Z, T);
+}
+
+/* Z = X*Y + A mod BPO */
+void eco_MulAddReduce(OUT U64 *Z, IN const U64 *X, IN const U64 *Y, IN const U64 *A)
+{
+    U64 T[8], C[4] = { 0 };
+    ecp_Mul(T, X, Y);                 /* T = X*Y */
+    C[0] = ecp_Add(T, T, A);          /* X*Y + A < 2^512 */
+    ecp_Add(T+4, T+4, C);
+    eco_Reduce512(Z, T);
+}
+
+#define BPO_MINV64  0xD2B51DA312547E1B /* -1/BPO mod 2**64 */
+
+/* Z = (X*Y)/R mod BPO */
+void eco_MontMul(OUT U64 *Z, IN const U64 *X, IN const U64 *Y)
+{
+    U64 T[6];
+    ecp_WordMulSet(T, X[0], Y);                 /* T = X[0]*Y */
+    T[5]  = ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_NxBPO[1]);
+    T[5]  = ecp_WordMulAdd(T, T+1, X[1], Y);    /* T = (T>>64) + X[1]*Y */
+    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_NxBPO[1]);
+    T[5]  = ecp_WordMulAdd(T, T+1, X[2], Y);    /* T = (T>>64) + X[2]*Y */
+    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_NxBPO[1]);
+    T[5]  = ecp_WordMulAdd(T, T+1, X[3], Y);    /* T = (T>>64) + X[3]*Y */
+    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_NxBPO[1]);
+    /* T + (-1/BPO)*T*BPO mod 2**64 = 0 --> T[0] = 0 */
+    /* T[5] could be 2 at most */
+    while (T[5] != 0) T[5] += ecp_Sub(T+1, T+1, _w_NxBPO[15]);
+    ecp_Copy(Z, T+1);   /* return T>>64 */
 }
 
 /* X mod BPO */
@@ -92,8 +119,5 @@ void eco_DigestToWords( OUT U64 *Y, IN const U8 *md)
     ecp_BytesToWords(T+4, md+32);
 
     /* Reduce T mod BPO */
-    eco_ReduceHiWord(T+3, T[7], T+3);
-    eco_ReduceHiWord(T+2, T[6], T+2);
-    eco_ReduceHiWord(T+1, T[5], T+1);
-    eco_ReduceHiWord(Y, T[4], T+0);
+    eco_Reduce512(Y, T);
 }
@@ -0,0 +1,11 @@
+EDP_BLINDING_CTX edp_custom_blinding = 
+{
+  W256(0x9CB99D16,0x467498C2,0xECFCB53C,0x7F96B8FD,0xD4FF47D9,0xE3EFFA2B,0xDEECB1D1,0x0CFB67B3),
+  W256(0x3B71EF75,0x7E0AC617,0x00DFDAB7,0x74671130,0x39C19CE0,0xB9CE7C47,0x9C1CDF07,0x9BC4169C),
+  {
+    W256(0x10A775F4,0xC256C5EE,0x55104250,0xE7AC4843,0x5715E1E8,0x8F62DFCF,0x40890B57,0xFB47111C),
+    W256(0xC3E2AA5A,0xCC5EF146,0x284FE60D,0x7847258A,0x2448900C,0x325E12E1,0xE431E850,0x0B92F998),
+    W256(0x9F6F1D42,0x900CB1DE,0xE4440B8B,0xFE832D60,0x7B20B97D,0x452E3597,0x4CF0B1EB,0x378B1E2A),
+    W256(0xA502F5AE,0xBDC12D82,0x97CCC856,0x3D1A2E1D,0xAD27B1BF,0x709E9A9E,0x0D13FA10,0x3768CFC3)
+  }
+};
@@ -40,6 +40,7 @@ const U8 ecp_BasePoint[32] = {
 void ecp_MontDouble(XZ_POINT *Y, const XZ_POINT *X)
 {
     U_WORD A[K_WORDS], B[K_WORDS];
+    ECP_COUNT(ECP_OP_MONT_DOUBLE);
     /*  x2 = (x+z)^2 * (x-z)^2 */
     /*  z2 = ((x+z)^2 - (x-z)^2)*((x+z)^2 + ((A-2)/4)((x+z)^2 - (x-z)^2)) */
     ecp_AddReduce(A, X->X, X->Z);       /* A = (x+z) */
@@ -57,6 +58,7 @@ void ecp_MontDouble(XZ_POINT *Y, const XZ_POINT *X)
 void ecp_Mont(XZ_POINT *P, XZ_POINT *Q, IN const U_WORD *Base)
 {
     U_WORD A[K_WORDS], B[K_WORDS], C[K_WORDS], D[K_WORDS], E[K_WORDS];
+    ECP_COUNT(ECP_OP_MONT_LADDER);
     /* x3 = ((x1-z1)(x2+z2) + (x1+z1)(x2-z2))^2*zb     zb=1 */
     /* z3 = ((x1-z1)(x2+z2) - (x1+z1)(x2-z2))^2*xb     xb=Base */
     ecp_SubReduce(A, P->X, P->Z);   /* A = x1-z1 */
@@ -183,9 +185,11 @@ void curve25519_dh_CalculatePublicKey_fast(
     unsigned char *pk,          /* [32-bytes] OUT: Public key */
     unsigned char *sk)          /* [32-bytes] IN/OUT: Your secret key */
 {
+    EDP_TRACE_ENTRY(dh_CalculatePublicKey_fast, sk, 0);
     ecp_TrimSecretKey(sk);
     /* Use faster method */
     x25519_BasePointMultiply(pk, sk);
+    EDP_TRACE_EXIT(dh_CalculatePublicKey_fast, sk, 0);
 }
 
 /* Return public key associated with sk */
@@ -193,8 +197,10 @@ void curve25519_dh_CalculatePublicKey(
     unsigned char *pk,          /* [32-bytes] OUT: Public key */
     unsigned char *sk)          /* [32-bytes] IN/OUT: Your secret key */
 {
+    EDP_TRACE_ENTRY(dh_CalculatePublicKey, sk, 0);
     ecp_TrimSecretKey(sk);
     ecp_PointMultiply(pk, ecp_BasePoint, sk, 32);
+    EDP_TRACE_EXIT(dh_CalculatePublicKey, sk, 0);
 }
 
 /* Create a shared secret */
@@ -203,6 +209,8 @@ void curve25519_dh_CreateSharedKey(
     const unsigned char *pk,    /* [32-bytes] IN: Other side's public key */
     unsigned char *sk)          /* [32-bytes] IN/OUT: Your secret key */
 {
+    EDP_TRACE_ENTRY(dh_CreateSharedKey, sk, 0);
     ecp_TrimSecretKey(sk);
     ecp_PointMultiply(shared, pk, sk, 32);
+    EDP_TRACE_EXIT(dh_CreateSharedKey, sk, 0);
 }
@@ -103,6 +103,7 @@ int ecp_CmpLT(const U32* X, const U32* Y)
 U32 ecp_Add(U32* Z, const U32* X, const U32* Y) 
 {
     M64 c;
+    ECP_COUNT(ECP_OP_ADD);
 
     ECP_ADD32(Z[0], X[0], Y[0]);
     ECP_ADC32(Z[1], X[1], Y[1]);
@@ -119,6 +120,7 @@ U32 ecp_Add(U32* Z, const U32* X, const U32* Y)
 S32 ecp_Sub(U32* Z, const U32* X, const U32* Y) 
 {
     M64 b;
+    ECP_COUNT(ECP_OP_SUB);
     ECP_SUB32(Z[0], X[0], Y[0]);
     ECP_SBC32(Z[1], X[1], Y[1]);
     ECP_SBC32(Z[2], X[2], Y[2]);
@@ -134,6 +136,7 @@ S32 ecp_Sub(U32* Z, const U32* X, const U32* Y)
 void ecp_AddReduce(U32* Z, const U32* X, const U32* Y) 
 {
     M64 c;
+    ECP_COUNT(ECP_OP_ADD_REDUCE);
     c.u32.hi = ecp_Add(Z, X, Y) * 38;
 
     /* Z += c.u32.hi * 38 */
@@ -161,6 +164,7 @@ void ecp_AddReduce(U32* Z, const U32* X, const U32* Y)
 void ecp_SubReduce(U32* Z, const U32* X, const U32* Y) 
 {
     M64 c;
+    ECP_COUNT(ECP_OP_SUB_REDUCE);
     c.u32.hi = ecp_Sub(Z, X, Y) & 38;
 
     ECP_SUB_C0(Z[0], Z[0], c.u32.hi);
@@ -186,6 +190,7 @@ void ecp_Mod(U32 *X)
 {
     U32 T[8];
     U32 c = (U32)ecp_Sub(X, X, _w_P);
+    ECP_COUNT(ECP_OP_MOD);
 
     /* set T = 0 if c=0, else T = P */
 
@@ -243,6 +248,7 @@ static void ecp_mul_add(U32* Y, U32 b, const U32* X)
 void ecp_WordMulAddReduce(U32 *Z, const U32* Y, U32 b, const U32* X) 
 {
     M64 c;
+    ECP_COUNT(ECP_OP_WORD_MUL);
     ECP_MULADD_W0(Z[0], Y[0], b, X[0]);
     ECP_MULADD_W1(Z[1], Y[1], b, X[1]);
     ECP_MULADD_W1(Z[2], Y[2], b, X[2]);
@@ -278,6 +284,7 @@ void ecp_WordMulAddReduce(U32 *Z, const U32* Y, U32 b, const U32* X)
 void ecp_MulReduce(U32* Z, const U32* X, const U32* Y) 
 {
     U32 T[16];
+    ECP_COUNT(ECP_OP_MUL_REDUCE);
 
     ecp_mul_set(T+0, X[0], Y);
     ecp_mul_add(T+1, X[1], Y);
@@ -296,6 +303,7 @@ void ecp_MulReduce(U32* Z, const U32* X, const U32* Y)
 /* Computes Z = X*Y */
 void ecp_Mul(U32* Z, const U32* X, const U32* Y) 
 {
+    ECP_COUNT(ECP_OP_MUL);
     ecp_mul_set(Z+0, X[0], Y);
     ecp_mul_add(Z+1, X[1], Y);
     ecp_mul_add(Z+2, X[2], Y);
@@ -309,6 +317,7 @@ void ecp_Mul(U32* Z, const U32* X, const U32* Y)
 /* Computes Z = X*Y mod P. */
 void ecp_SqrReduce(U32* Y, const U32* X) 
 {
+    ECP_COUNT(ECP_OP_SQR_REDUCE);
     /* TBD: Implementation is based on multiply */
     /*      Optimize for squaring */
 
@@ -331,10 +340,34 @@ void ecp_SqrReduce(U32* Y, const U32* X)
 /* Computes Z = X*Y mod P. */
 void ecp_MulMod(U32* Z, const U32* X, const U32* Y) 
 {
+    ECP_COUNT(ECP_OP_MUL_MOD);
     ecp_MulReduce(Z, X, Y);
     ecp_Mod(Z);
 }
 
+#if ECP_SMALL_FOOTPRINT
+/* Return out = 1/z mod P */
+/* Same addition chain as below with four temporaries instead of ten */
+void ecp_Inverse(U32 *out, const U32 *z) 
+{
+  U32 a[8], b[8], c[8], t[8];
+  ECP_COUNT(ECP_OP_INVERSE);
+
+  /* 2 */               ecp_SqrReduce(t,z);
+  /* 9 */               ecp_SrqMulReduce(b,t,2,z);
+  /* 11 */              ecp_MulReduce(a,b,t);
+  /* 22 */              ecp_SqrReduce(t,a);
+  /* 2^5 - 2^0 = 31 */  ecp_MulReduce(b,t,b);
+  /* 2^10 - 2^0 */      ecp_SrqMulReduce(c,b,5,b);
+  /* 2^20 - 2^0 */      ecp_SrqMulReduce(b,c,10,c);
+  /* 2^40 - 2^0 */      ecp_SrqMulReduce(t,b,20,b);
+  /* 2^50 - 2^0 */      ecp_SrqMulReduce(c,t,10,c);
+  /* 2^100 - 2^0 */     ecp_SrqMulReduce(b,c,50,c);
+  /* 2^200 - 2^0 */     ecp_SrqMulReduce(t,b,100,b);
+  /* 2^250 - 2^0 */     ecp_SrqMulReduce(t,t,50,c);
+  /* 2^255 - 21 */      ecp_SrqMulReduce(out,t,5,a);
+}
+#else
 /* Courtesy of DJB */
 /* Return out = 1/z mod P */
 void ecp_Inverse(U32 *out, const U32 *z) 
@@ -342,6 +375,7 @@ void ecp_Inverse(U32 *out, const U32 *z)
   int i;
   U32 t0[8],t1[8],z2[8],z9[8],z11[8];
   U32 z2_5_0[8],z2_10_0[8],z2_20_0[8],z2_50_0[8],z2_100_0[8];
+  ECP_COUNT(ECP_OP_INVERSE);
 
   /* 2 */               ecp_SqrReduce(z2,z);
   /* 4 */               ecp_SqrReduce(t1,z2);
@@ -407,4 +441,5 @@ void ecp_Inverse(U32 *out, const U32 *z)
   /* 2^255 - 2^5 */     ecp_SqrReduce(t1,t0);
   /* 2^255 - 21 */      ecp_MulReduce(out,t1,z11);
 }
+#endif
 
@@ -29,6 +29,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include "BaseTypes.h"
 
 #define ECP_VERSION_STR     "1.2.0"
@@ -87,6 +88,66 @@ typedef struct {
     PE_POINT BP;
 } EDP_BLINDING_CTX;
 
+/* Expanded signing key */
+typedef struct {
+    U_WORD a[K_WORDS];          /* secret scalar, trimmed H(sk)[0..31] */
+    U8 b[32];                   /* nonce prefix, H(sk)[32..63] */
+    U8 pk[32];                  /* encoded public key */
+    const void *blinding;       /* null or blinding context */
+} EDP_SIGN_CTX;
+
+/* Fixed-base comb: number of 8-fold tables (see Rules.mk) */
+#ifndef ECP_BASE_TABLES
+#define ECP_BASE_TABLES     1
+#endif
+/* Constant-time (masked scan) lookup of base table slices (see Rules.mk) */
+#ifndef ECP_CT_LOOKUP
+#define ECP_CT_LOOKUP       1
+#endif
+
+/* Small-footprint profile (see Rules.mk): 1 = small tables, 2 = base table 
+   is built at first use instead of being stored in .rodata */
+#ifndef ECP_SMALL_FOOTPRINT
+#define ECP_SMALL_FOOTPRINT 0
+#endif
+
+#if ECP_SMALL_FOOTPRINT
+
+#if ECP_BASE_TABLES > 1
+#error ECP_BASE_TABLES > 1 is not supported by the small-footprint profile
+#endif
+/* Signed-digit table: P3 + SUM(+/-P0,..,+/-P2) */
+#define ECP_BASE_SLICES     64
+#define ECP_BASE_ENTRIES    8
+#define ecp_BaseSignedFolds ecp_4SignedFolds
+#if ECP_SMALL_FOOTPRINT > 1
+const PA_POINT *edp_BaseTable(void);
+#else
+/* Generated by custom_tool into base_folding4.h */
+extern const PA_POINT _w_base_folding4[8];
+#define edp_BaseTable()     _w_base_folding4
+#endif
+
+#else
+
+/* Signed-digit tables: P7 + SUM(+/-P0,..,+/-P6) */
+#define ECP_BASE_SLICES     32
+#define ECP_BASE_ENTRIES    128
+#define ecp_BaseSignedFolds ecp_8SignedFolds
+#if ECP_BASE_TABLES > 1
+/* Generated by custom_tool into base_comb.h, table 0 is the base folding */
+extern const PA_POINT _w_base_comb8[ECP_BASE_TABLES][128];
+#define _w_base_folding8    _w_base_comb8[0]
+#else
+extern const PA_POINT _w_base_folding8[128];
+#endif
+#define edp_BaseTable()     _w_base_folding8
+
+#endif /* ECP_SMALL_FOOTPRINT */
+
+/* 0*P and 1*P in pre-computed affine form */
+extern const PA_POINT _w_base_multiples[2];
+
 extern const U8 ecp_BasePoint[K_BYTES];
 
 /* Return point Q = k*P */
@@ -116,10 +177,18 @@ void eco_ToMont(OUT U_WORD *Y, IN const U_WORD *X);
 void eco_FromMont(OUT U_WORD *Y, IN const U_WORD *X);
 /* Calculate Y = X**E mod BPO */
 void eco_ExpModBPO(OUT U_WORD *Y, IN const U_WORD *X, IN const U8 *E, IN int bytes);
-/* Calculate Y = 1/X mod BPO */
+/* Calculate Y = 1/X mod BPO (safegcd, constant-time, 1/0 = 0) */
 void eco_InvModBPO(OUT U_WORD *Y, IN const U_WORD *X);
+/* Calculate Y = 1/X mod BPO as X**(BPO-2) */
+void eco_InvModBPO_Exp(OUT U_WORD *Y, IN const U_WORD *X);
+/* Y[i] = 1/X[i] mod BPO for count scalars (K_WORDS each), one inversion */
+void eco_BatchInvModBPO(OUT U_WORD *Y, IN const U_WORD *X, IN int count);
 /* Z = X*Y mod BPO */
 void eco_MulReduce(OUT U_WORD *Z, IN const U_WORD *X, IN const U_WORD *Y);
+/* Z = X*Y + A mod BPO */
+void eco_MulAddReduce(OUT U_WORD *Z, IN const U_WORD *X, IN const U_WORD *Y, IN const U_WORD *A);
+/* Y = T mod BPO where T is 512-bit (2*K_WORDS words) */
+void eco_Reduce512(OUT U_WORD *Y, IN const U_WORD *T);
 /* Return Y = D mod BPO where D is 512-bit big-endian byte array (i.e SHA512 digest) */
 void eco_DigestToWords( OUT U_WORD *Y, IN const U8 *D);
 /* Z = X + Y mod BPO */
@@ -139,6 +208,8 @@ void ecp_SubReduce(U_WORD* Z, const U_WORD* X, const U_WORD* Y);
 void ecp_MulReduce(U_WORD* Z, const U_WORD* X, const U_WORD* Y);
 void ecp_SqrReduce(U_WORD* Y, const U_WORD* X);
 void ecp_ModExp2523(U_WORD *Y, const U_WORD *X);
+/* Computes Z = X^(2^n) * Y */
+void ecp_SrqMulReduce(U_WORD *Z, const U_WORD *X, int n, const U_WORD *Y);
 void ecp_Inverse(U_WORD *out, const U_WORD *z);
 void ecp_MulMod(U_WORD* Z, const U_WORD* X, const U_WORD* Y);
 void ecp_Mul(U_WORD* Z, const U_WORD* X, const U_WORD* Y);
@@ -155,11 +226,36 @@ int ecp_CmpLT(const U_WORD* X, const U_WORD* Y);
 void eco_ReduceHiWord(U_WORD* Y, U_WORD b, const U_WORD* X);
 
 /* -- ed25519 --------------------------------------------------------------- */
+/* Context memory through the allocator set by ed25519_SetAllocator */
+void *edp_Alloc(size_t size);
+void edp_Free(void *ptr);
+
+/* Spin lock on a long */
+#if defined(__GNUC__)
+#define EDP_LOCK(l)     while (__atomic_exchange_n(l, 1, __ATOMIC_ACQUIRE))
+#define EDP_UNLOCK(l)   __atomic_store_n(l, 0, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define EDP_LOCK(l)     while (_InterlockedExchange(l, 1))
+#define EDP_UNLOCK(l)   _InterlockedExchange(l, 0)
+#else
+#define EDP_LOCK(l)
+#define EDP_UNLOCK(l)
+#endif
+/* Low-latency mode: run fn(arg) on a spinning helper thread.
+   edp_Helper_Post returns null when no helper is free (caller runs fn) */
+typedef void (*edp_helper_fn)(void *arg);
+void *edp_Helper_Post(edp_helper_fn fn, void *arg);
+void edp_Helper_Join(void *helper);
 void ed25519_UnpackPoint(Affine_POINT *r, const unsigned char *p);
 void ed25519_CalculateX(OUT U_WORD *X, IN const U_WORD *Y, U_WORD parity);
 void edp_AddAffinePoint(Ext_POINT *p, const PA_POINT *q);
+void edp_SubAffinePoint(Ext_POINT *p, const PA_POINT *q);
+/* Constant-time p = table[index] from a base table of ECP_BASE_ENTRIES */
+void edp_ScanSlice(PA_POINT *p, const PA_POINT *table, U32 index);
 void edp_AddBasePoint(Ext_POINT *p);
 void edp_AddPoint(Ext_POINT *r, const Ext_POINT *p, const PE_POINT *q);
+void edp_SubPoint(Ext_POINT *r, const Ext_POINT *p, const PE_POINT *q);
 void edp_DoublePoint(Ext_POINT *p);
 void edp_ComputePermTable(PE_POINT *qtable, Ext_POINT *Q);
 void edp_ExtPoint2PE(PE_POINT *r, const Ext_POINT *p);
@@ -168,6 +264,176 @@ void edp_BasePointMultiply(OUT Affine_POINT *Q, IN const U_WORD *sk,
     IN const void *blinding);
 void ecp_4Folds(U8* Y, const U_WORD* X);
 void ecp_8Folds(U8* Y, const U_WORD* X);
+/* Signed-digit folding of odd X: Y[i] = (neg << (folds-1)) | index */
+void ecp_4SignedFolds(U8* Y, const U_WORD* X);
+void ecp_8SignedFolds(U8* Y, const U_WORD* X);
+
+/* -- operation counters ---------------------------------------------------- */
+/*  ECP_COUNT_OPS=1 (see Rules.mk): field, scalar, point and SHA-512 block
+    functions count their calls in thread-local counters. Nested calls are
+    counted too: one ecp_Inverse also adds its squarings and multiplies.
+    Work done on low-latency helpers is counted by the helper threads.
+*/
+#ifndef ECP_COUNT_OPS
+#define ECP_COUNT_OPS       0
+#endif
+
+enum {
+    /* field */
+    ECP_OP_ADD,             /* ecp_Add */
+    ECP_OP_SUB,             /* ecp_Sub */
+    ECP_OP_ADD_REDUCE,      /* ecp_AddReduce */
+    ECP_OP_SUB_REDUCE,      /* ecp_SubReduce */
+    ECP_OP_MOD,             /* ecp_Mod */
+    ECP_OP_WORD_MUL,        /* ecp_WordMulAddReduce */
+    ECP_OP_MUL,             /* ecp_Mul */
+    ECP_OP_MUL_REDUCE,      /* ecp_MulReduce */
+    ECP_OP_SQR_REDUCE,      /* ecp_SqrReduce */
+    ECP_OP_MUL_MOD,         /* ecp_MulMod */
+    ECP_OP_SQR_MUL,         /* ecp_SrqMulReduce */
+    ECP_OP_MOD_EXP,         /* ecp_ModExp2523 */
+    ECP_OP_INVERSE,         /* ecp_Inverse */
+    ECP_OP_ENCODE,          /* ecp_EncodeInt */
+    ECP_OP_DECODE,          /* ecp_DecodeInt */
+    ECP_OP_4FOLDS,          /* ecp_4Folds */
+    ECP_OP_8FOLDS,          /* ecp_8Folds */
+    /* scalar (mod BPO) */
+    ECO_OP_REDUCE_HI,       /* eco_ReduceHiWord */
+    ECO_OP_REDUCE512,       /* eco_Reduce512 */
+    ECO_OP_MUL_REDUCE,      /* eco_MulReduce */
+    ECO_OP_MUL_ADD_REDUCE,  /* eco_MulAddReduce */
+    ECO_OP_ADD_REDUCE,      /* eco_AddReduce */
+    ECO_OP_MOD,             /* eco_Mod */
+    ECO_OP_MONT_MUL,        /* eco_MontMul */
+    ECO_OP_DIGEST,          /* eco_DigestToWords */
+    ECO_OP_EXP,             /* eco_ExpModBPO */
+    ECO_OP_INVERSE,         /* eco_InvModBPO, eco_InvModBPO_Exp */
+    ECO_OP_BATCH_INVERSE,   /* eco_BatchInvModBPO */
+    /* point */
+    EDP_OP_DOUBLE,          /* edp_DoublePoint */
+    EDP_OP_ADD,             /* edp_AddPoint, edp_SubPoint */
+    EDP_OP_ADD_AFFINE,      /* edp_AddAffinePoint, edp_SubAffinePoint */
+    EDP_OP_ADD_BASE,        /* edp_AddBasePoint */
+    EDP_OP_TO_PE,           /* edp_ExtPoint2PE */
+    EDP_OP_LOOKUP,          /* base table lookups (edp_ScanSlice) */
+    EDP_OP_DECOMPRESS,      /* ed25519_CalculateX */
+    EDP_OP_BASE_MULT,       /* edp_BasePointMult */
+    EDP_OP_POLY_MULT,       /* a*B + b*Q (verify) */
+    ECP_OP_MONT_DOUBLE,     /* ecp_MontDouble (X25519) */
+    ECP_OP_MONT_LADDER,     /* ecp_Mont (X25519) */
+    /* hash */
+    SHA_OP_BLOCK,           /* SHA-512 compressions */
+    SHA_OP_BLOCK_X4,        /* 4-lane multi-buffer compressions */
+    ECP_OP_COUNT
+};
+
+typedef struct {
+    U64 n[ECP_OP_COUNT];
+} ECP_OP_COUNTS;
+
+#if ECP_COUNT_OPS
+#ifdef USE_ASM_LIB
+#error ECP_COUNT_OPS needs the portable C library (asm primitives are not counted)
+#endif
+#if defined(_MSC_VER)
+#define ECP_THREAD_LOCAL    __declspec(thread)
+#else
+#define ECP_THREAD_LOCAL    __thread
+#endif
+extern ECP_THREAD_LOCAL U64 ecp_op_count[ECP_OP_COUNT];
+#define ECP_COUNT(op)       (ecp_op_count[op]++)
+#define ECP_COUNT_N(op,n)   (ecp_op_count[op] += (n))
+
+/* Counters of the calling thread */
+void ecp_OpCounts_Snapshot(ECP_OP_COUNTS *counts);
+void ecp_OpCounts_Reset(void);
+const char *ecp_OpName(int op);
+#else
+#define ECP_COUNT(op)       ((void)0)
+#define ECP_COUNT_N(op,n)   ((void)0)
+#endif
+
+/* -- API tracing ----------------------------------------------------------- */
+/*  Every public sign, verify and DH function opens with EDP_TRACE_ENTRY
+    (after its declarations) and calls EDP_TRACE_EXIT before it returns.
+    Both expand to nothing unless enabled (see Rules.mk):
+    ECP_TRACE=1     USDT probes curve25519:<api>__entry/<api>__return with
+                    (context or key, size). Needs <sys/sdt.h>.
+    ECP_LATENCY=1   per-API latency histograms (ed25519_Latency_Snapshot).
+    The context is the context pointer, or the key of one-shot calls. size
+    is the message size, the item count of batch, key sequence, pool and
+    cache calls, the seed size of ed25519_Blinding_Init, otherwise 0.
+    Only calls made by the application are recorded: public APIs share
+    untraced edp_* bodies and never call each other.
+*/
+#ifndef ECP_TRACE
+#define ECP_TRACE           0
+#endif
+#ifndef ECP_LATENCY
+#define ECP_LATENCY         0
+#endif
+
+enum {
+    /* ed25519_sign.c */
+    EDP_API_Blinding_Init,
+    EDP_API_Blinding_Refresh,
+    EDP_API_Blinding_Finish,
+    EDP_API_CreateKeyPair,
+    EDP_API_DerivePublicKeys,
+    EDP_API_DerivePublicKey,
+    EDP_API_KeySeq_Init,
+    EDP_API_KeySeq_Next,
+    EDP_API_KeySeq_Finish,
+    EDP_API_Sign_Init,
+    EDP_API_Sign_Derive,
+    EDP_API_Sign_WithCtx,
+    EDP_API_SignBatch,
+    EDP_API_Sign_Finish,
+    EDP_API_SignPool_Init,
+    EDP_API_SignPool_Refill,
+    EDP_API_SignPool_Start,
+    EDP_API_Sign_FromPool,
+    EDP_API_SignPool_Finish,
+    EDP_API_SignMessage,
+    /* ed25519_verify.c */
+    EDP_API_VerifySignature,
+    EDP_API_Verify_Init,
+    EDP_API_Verify_InitEx,
+    EDP_API_Verify_Finish,
+    EDP_API_Verify_Check,
+    EDP_API_Verify_CheckBatch,
+    EDP_API_VerifyCache_Init,
+    EDP_API_VerifyCache_Finish,
+    EDP_API_Verify_CheckCached,
+    /* curve25519_dh.c */
+    EDP_API_dh_CalculatePublicKey_fast,
+    EDP_API_dh_CalculatePublicKey,
+    EDP_API_dh_CreateSharedKey,
+    EDP_API_COUNT
+};
+
+#if ECP_TRACE
+#include <sys/sdt.h>
+#define EDP_PROBE(api,ctx,size) \
+    STAP_PROBE2(curve25519, api, (const void*)(ctx), (size_t)(size))
+#else
+#define EDP_PROBE(api,ctx,size) ((void)0)
+#endif
+
+#if ECP_LATENCY
+U64 edp_LatencyNow(void);
+void edp_LatencyRecord(int api, U64 start);
+#define EDP_LATENCY_START   U64 edp_latency_t0 = edp_LatencyNow()
+#define EDP_LATENCY_STOP(api) edp_LatencyRecord(EDP_API_##api, edp_latency_t0)
+#else
+#define EDP_LATENCY_START   ((void)0)
+#define EDP_LATENCY_STOP(api) ((void)0)
+#endif
+
+#define EDP_TRACE_ENTRY(api,ctx,size) \
+    EDP_LATENCY_START; EDP_PROBE(api##__entry, ctx, size)
+#define EDP_TRACE_EXIT(api,ctx,size) \
+    do { EDP_PROBE(api##__return, ctx, size); EDP_LATENCY_STOP(api); } while (0)
 
 #ifdef __cplusplus
 }
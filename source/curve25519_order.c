@@ -81,6 +81,7 @@ void eco_ReduceHiWord(U32* Y, U32 b, const U32* X)
 {
     M64 c;
     U32 T[8];
+    ECP_COUNT(ECO_OP_REDUCE_HI);
 
     /* Set T = b*(-R) */
 
@@ -106,25 +107,173 @@ void eco_ReduceHiWord(U32* Y, U32 b, const U32* X)
     ecp_Add(Y, Y, _w_NxBPO[c.s32.hi & 1]);
 }
 
+#if defined(__SIZEOF_INT128__) && !defined(ECP_NO_INT128)
+/* 
+    Compilers with a 128-bit integer type get to work on 64-bit limbs:
+    the 512-bit product takes 16 multiplies instead of 64 and the
+    reduction takes 4 folds of 64 bits instead of 8 folds of 32 bits.
+    Same folding as eco_ReduceHiWord, kept in registers.
+*/
+#define ECO_LIMBS64
+
+typedef unsigned __int128 U128;
+
+#define LIMB64(p,i)    ((U64)(p)[2*(i)] | ((U64)(p)[2*(i)+1] << 32))
+
+/* [X3:X0] = [b:X3:X0] mod BPO, 64-bit limbs */
+static void eco_Fold64(U64 *X, U64 b)
+{
+    U128 c;
+    U64 t0, t1, t2, t3, m;
+
+    /* t = b*(-R), 193-bits at most */
+    c = (U128)b*0x812631A5CF5D3ED0ULL;
+    t0 = (U64)c;
+    c = (U128)b*0x4DEF9DEA2F79CD65ULL + (U64)(c >> 64);
+    t1 = (U64)c;
+    c = (U128)b + (U64)(c >> 64);
+    t2 = (U64)c;
+    t3 = (U64)(c >> 64);
+
+    /* X = X - t */
+    c = (U128)X[0] - t0;
+    X[0] = (U64)c;
+    c = (U128)X[1] - t1 - (U64)(c >> 127);
+    X[1] = (U64)c;
+    c = (U128)X[2] - t2 - (U64)(c >> 127);
+    X[2] = (U64)c;
+    c = (U128)X[3] - t3 - (U64)(c >> 127);
+    X[3] = (U64)c;
+
+    /* Add BPO if there is a borrow */
+    m = 0 - (U64)(c >> 127);
+    c = (U128)X[0] + (m & 0x5812631A5CF5D3EDULL);
+    X[0] = (U64)c;
+    c = (U128)X[1] + (m & 0x14DEF9DEA2F79CD6ULL) + (U64)(c >> 64);
+    X[1] = (U64)c;
+    c = (U128)X[2] + (U64)(c >> 64);
+    X[2] = (U64)c;
+    X[3] += (m & 0x1000000000000000ULL) + (U64)(c >> 64);
+}
+
+/* T[8] = X*Y, 64-bit limbs */
+static void eco_Mul64(U64 *T, const U64 *X, const U64 *Y)
+{
+    int i, j;
+    U128 c;
+
+    for (i = 0; i < 8; i++) T[i] = 0;
+    for (i = 0; i < 4; i++)
+    {
+        c = 0;
+        for (j = 0; j < 4; j++)
+        {
+            c = (U128)X[i]*Y[j] + T[i+j] + (U64)(c >> 64);
+            T[i+j] = (U64)c;
+        }
+        T[i+4] = (U64)(c >> 64);
+    }
+}
+
+/* Y = T[8] mod BPO; T is overwritten */
+static void eco_Reduce64(U32 *Y, U64 *T)
+{
+    int i;
+    eco_Fold64(T+3, T[7]);
+    eco_Fold64(T+2, T[6]);
+    eco_Fold64(T+1, T[5]);
+    eco_Fold64(T+0, T[4]);
+    for (i = 0; i < 4; i++)
+    {
+        Y[2*i] = (U32)T[i];
+        Y[2*i+1] = (U32)(T[i] >> 32);
+    }
+}
+#endif
+
+/* Y = T mod BPO where T is 512-bit */
+void eco_Reduce512(OUT U32 *Y, IN const U32 *T)
+{
+#ifdef ECO_LIMBS64
+    int i;
+    U64 t[8];
+    ECP_COUNT(ECO_OP_REDUCE512);
+    for (i = 0; i < 8; i++) t[i] = LIMB64(T, i);
+    eco_Reduce64(Y, t);
+#else
+    U32 t[16];
+    ECP_COUNT(ECO_OP_REDUCE512);
+    ecp_Copy(t, T);
+    ecp_Copy(t+8, T+8);
+    eco_ReduceHiWord(t+7, t[15], t+7);
+    eco_ReduceHiWord(t+6, t[14], t+6);
+    eco_ReduceHiWord(t+5, t[13], t+5);
+    eco_ReduceHiWord(t+4, t[12], t+4);
+    eco_ReduceHiWord(t+3, t[11], t+3);
+    eco_ReduceHiWord(t+2, t[10], t+2);
+    eco_ReduceHiWord(t+1, t[9], t+1);
+    eco_ReduceHiWord(Y, t[8], t+0);
+#endif
+}
+
 /* Z = X*Y mod BPO */
 void eco_MulReduce(OUT U32 *Z, IN const U32 *X, IN const U32 *Y)
 {
+#ifdef ECO_LIMBS64
+    U64 x[4], y[4], T[8];
+    int i;
+    ECP_COUNT(ECO_OP_MUL_REDUCE);
+    for (i = 0; i < 4; i++)
+    {
+        x[i] = LIMB64(X, i);
+        y[i] = LIMB64(Y, i);
+    }
+    eco_Mul64(T, x, y);
+    eco_Reduce64(Z, T);
+#else
     U32 T[16];
+    ECP_COUNT(ECO_OP_MUL_REDUCE);
     ecp_Mul(T, X, Y);                 /* T = X*Y */
-    eco_ReduceHiWord(T+7, T[15], T+7);
-    eco_ReduceHiWord(T+6, T[14], T+6);
-    eco_ReduceHiWord(T+5, T[13], T+5);
-    eco_ReduceHiWord(T+4, T[12], T+4);
-    eco_ReduceHiWord(T+3, T[11], T+3);
-    eco_ReduceHiWord(T+2, T[10], T+2);
-    eco_ReduceHiWord(T+1, T[9], T+1);
-    eco_ReduceHiWord(Z, T[8], T+0);
+    eco_Reduce512(Z, T);
+#endif
+}
+
+/* Z = X*Y + A mod BPO */
+void eco_MulAddReduce(OUT U32 *Z, IN const U32 *X, IN const U32 *Y, IN const U32 *A)
+{
+#ifdef ECO_LIMBS64
+    U64 x[4], y[4], T[8];
+    U128 c = 0;
+    int i;
+    ECP_COUNT(ECO_OP_MUL_ADD_REDUCE);
+    for (i = 0; i < 4; i++)
+    {
+        x[i] = LIMB64(X, i);
+        y[i] = LIMB64(Y, i);
+    }
+    eco_Mul64(T, x, y);
+    /* X*Y + A < 2^512, no carry out */
+    for (i = 0; i < 8; i++)
+    {
+        c = (U128)T[i] + (i < 4 ? LIMB64(A, i) : 0) + (U64)(c >> 64);
+        T[i] = (U64)c;
+    }
+    eco_Reduce64(Z, T);
+#else
+    U32 T[16], C[8] = { 0 };
+    ECP_COUNT(ECO_OP_MUL_ADD_REDUCE);
+    ecp_Mul(T, X, Y);                 /* T = X*Y */
+    C[0] = ecp_Add(T, T, A);
+    ecp_Add(T+8, T+8, C);
+    eco_Reduce512(Z, T);
+#endif
 }
 
 /* X mod BPO */
 void eco_Mod(U32 *X)
 {
     S32 c = ecp_Sub(X, X, _w_NxBPO[X[7] >> 28]);
+    ECP_COUNT(ECO_OP_MOD);
     ecp_Add(X, X, _w_NxBPO[c & 1]);
 }
 
@@ -132,24 +281,58 @@ void eco_Mod(U32 *X)
 void eco_AddReduce(OUT U32 *Z, IN const U32 *X, IN const U32 *Y)
 {
     U32 c = ecp_Add(Z, X, Y);
+    ECP_COUNT(ECO_OP_ADD_REDUCE);
     eco_ReduceHiWord(Z, c, Z);
 }
 
+#define BPO_MINV32  0x12547E1B  /* -1/BPO mod 2**32 */
+
+#define ECO_MULADD_W0(Z,Y,b,X) c.u64 = (U64)(b)*(X) + (Y); Z = c.u32.lo;
+#define ECO_MULADD_W1(Z,Y,b,X) c.u64 = (U64)(b)*(X) + (U64)(Y) + c.u32.hi; Z = c.u32.lo;
+
+/* Computes Z[9] = Y[9] + b*X[8] and return carry */
+static U32 eco_WordMulAdd(U32 *Z, const U32* Y, U32 b, const U32* X) 
+{
+    M64 c;
+    ECO_MULADD_W0(Z[0], Y[0], b, X[0]);
+    ECO_MULADD_W1(Z[1], Y[1], b, X[1]);
+    ECO_MULADD_W1(Z[2], Y[2], b, X[2]);
+    ECO_MULADD_W1(Z[3], Y[3], b, X[3]);
+    ECO_MULADD_W1(Z[4], Y[4], b, X[4]);
+    ECO_MULADD_W1(Z[5], Y[5], b, X[5]);
+    ECO_MULADD_W1(Z[6], Y[6], b, X[6]);
+    ECO_MULADD_W1(Z[7], Y[7], b, X[7]);
+    c.u64 = (U64)Y[8] + c.u32.hi;
+    Z[8] = c.u32.lo;
+    return c.u32.hi;    /* 0 or 1 as the carry out */
+}
+
+/* Z = (X*Y)/R mod BPO */
+void eco_MontMul(OUT U32 *Z, IN const U32 *X, IN const U32 *Y)
+{
+    int i;
+    U32 T[10] = {0};
+    ECP_COUNT(ECO_OP_MONT_MUL);
+    for (i = 0; i < 8; i++)
+    {
+        T[9]  = eco_WordMulAdd(T, T+1, X[i], Y);     /* T = (T>>32) + X[i]*Y */
+        T[9] += eco_WordMulAdd(T, T, BPO_MINV32 * T[0], _w_NxBPO[1]);
+        /* T + (-1/BPO)*T*BPO mod 2**32 = 0 --> T[0] = 0 */
+    }
+    /* T[9] could be 2 at most */
+    while (T[9] != 0) T[9] += ecp_Sub(T+1, T+1, _w_NxBPO[15]);
+    ecp_Copy(Z, T+1);
+}
+
 /* Return Y = D mod BPO where D is 512-bit message digest (i.e SHA512 digest) */
 void eco_DigestToWords( OUT U32 *Y, IN const U8 *md)
 {
     U32 T[16];
+    ECP_COUNT(ECO_OP_DIGEST);
 
     /* We use digest value as little-endian byte array. */
     ecp_BytesToWords(T, md);
     ecp_BytesToWords(T+8, md+32);
 
-    eco_ReduceHiWord(T+7, T[15], T+7);
-    eco_ReduceHiWord(T+6, T[14], T+6);
-    eco_ReduceHiWord(T+5, T[13], T+5);
-    eco_ReduceHiWord(T+4, T[12], T+4);
-    eco_ReduceHiWord(T+3, T[11], T+3);
-    eco_ReduceHiWord(T+2, T[10], T+2);
-    eco_ReduceHiWord(T+1, T[9], T+1);
-    eco_ReduceHiWord(Y, T[8], T+0);
+    eco_Reduce512(Y, T);
 }
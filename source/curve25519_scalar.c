@@ -0,0 +1,361 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "curve25519_mehdi.h"
+
+/*
+  Scalar (mod BPO) helpers shared by the C and asm builds:
+  Montgomery form, exponentiation, inversion and batch inversion.
+
+    BPO = 2**252 + 27742317777372353535851937790883648493
+
+  eco_InvModBPO uses the safegcd algorithm of Bernstein and Yang
+  ("Fast constant-time gcd computation and modular inversion", 2019) in
+  the half-delta form: 20 rounds of 30 divsteps on 30-bit signed limbs.
+  600 divsteps are enough for any 256-bit modulus, and every round
+  runs the same instructions whatever the input.
+*/
+
+extern const U_WORD _w_NxBPO[16][K_WORDS];
+
+static const U_WORD _w_One[K_WORDS] = W256(1,0,0,0,0,0,0,0);
+
+/* R = 2**256 mod BPO */
+/* R2 = R**2 mod BPO */
+/* R2 = 0x0399411B7C309A3DCEEC73D217F5BE65D00E1BA768859347A40611E3449C0F01 */
+static const U_WORD _w_R2[K_WORDS] =
+    W256(0x449C0F01,0xA40611E3,0x68859347,0xD00E1BA7,
+         0x17F5BE65,0xCEEC73D2,0x7C309A3D,0x0399411B);
+
+static const U8 _b_BPOm2[32] = {      /* BasePointOrder - 2 */
+    0xEB,0xD3,0xF5,0x5C,0x1A,0x63,0x12,0x58,0xD6,0x9C,0xF7,0xA2,0xDE,0xF9,0xDE,0x14,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10 };
+
+/* Return Y = X*R mod BPO */
+void eco_ToMont(OUT U_WORD *Y, IN const U_WORD *X)
+{
+    eco_MontMul(Y, X, _w_R2);
+}
+
+/* Return Y = X/R mod BPO */
+void eco_FromMont(OUT U_WORD *Y, IN const U_WORD *X)
+{
+    eco_MontMul(Y, X, _w_One);
+}
+
+#define ECO_SQRMUL(n) eco_MulReduce(Y,Y,Y); if(e & n) eco_MulReduce(Y,Y,X)
+
+/* Calculate Y = X**E mod BPO */
+void eco_ExpModBPO(OUT U_WORD *Y, IN const U_WORD *X, IN const U8 *E, IN int bytes)
+{
+    U8 e;
+    ECP_COUNT(ECO_OP_EXP);
+    ecp_SetValue(Y, 1);
+
+    while (bytes > 0)
+    {
+        e = E[--bytes];
+        ECO_SQRMUL(0x80);
+        ECO_SQRMUL(0x40);
+        ECO_SQRMUL(0x20);
+        ECO_SQRMUL(0x10);
+        ECO_SQRMUL(0x08);
+        ECO_SQRMUL(0x04);
+        ECO_SQRMUL(0x02);
+        ECO_SQRMUL(0x01);
+    }
+}
+
+/* Calculate Y = 1/X mod BPO using Fermat: X**(BPO-2) */
+void eco_InvModBPO_Exp(OUT U_WORD *Y, IN const U_WORD *X)
+{
+    ECP_COUNT(ECO_OP_INVERSE);
+    eco_ExpModBPO(Y, X, _b_BPOm2, 32);
+}
+
+/* -- safegcd --------------------------------------------------------------- */
+
+#define ECO_M30     0x3FFFFFFF
+#define ECO_LIMBS   9               /* 9*30 = 270 bits */
+#define ECO_WBITS   (8*(int)sizeof(U_WORD))
+
+/* BPO as 30-bit limbs */
+static const S32 _s30_BPO[ECO_LIMBS] = {
+    0x1CF5D3ED, 0x20498C69, 0x2F79CD65, 0x37BE77A8, 0x14, 0, 0, 0, 0x1000 };
+
+#define BPO_INV30   0x2DAB81E5      /* 1/BPO mod 2**30 */
+
+/* Transition matrix of 30 divsteps, scaled by 2**30 */
+typedef struct
+{
+    S32 u, v, q, r;
+} ECO_TRANS;
+
+static void eco_ToS30(S32 *r, const U_WORD *X)
+{
+    int i, w, s;
+    U_WORD v;
+    for (i = 0; i < ECO_LIMBS; i++)
+    {
+        w = (30*i) / ECO_WBITS;
+        s = (30*i) % ECO_WBITS;
+        v = (w < K_WORDS) ? X[w] >> s : 0;
+        if (s + 30 > ECO_WBITS && w + 1 < K_WORDS) v |= X[w+1] << (ECO_WBITS - s);
+        r[i] = (S32)(v & ECO_M30);
+    }
+}
+
+/* r must be normalized: 0 <= r < BPO */
+static void eco_FromS30(U_WORD *Y, const S32 *r)
+{
+    int i, w, s;
+    for (i = 0; i < K_WORDS; i++) Y[i] = 0;
+    for (i = 0; i < ECO_LIMBS; i++)
+    {
+        w = (30*i) / ECO_WBITS;
+        s = (30*i) % ECO_WBITS;
+        if (w < K_WORDS) Y[w] |= (U_WORD)r[i] << s;
+        if (s + 30 > ECO_WBITS && w + 1 < K_WORDS) Y[w+1] |= (U_WORD)r[i] >> (ECO_WBITS - s);
+    }
+}
+
+/* 30 divsteps on the low bits of f and g. Returns the new zeta = -(delta+1/2). */
+static S32 eco_Divsteps30(S32 zeta, U32 f, U32 g, ECO_TRANS *t)
+{
+    /* u,v,q,r are kept mod 2**32 so the left shifts are defined */
+    U32 u = 1, v = 0, q = 0, r = 1;
+    volatile U32 c1, c2;
+    U32 mask1, mask2, x, y, z;
+    int i;
+
+    for (i = 0; i < 30; i++)
+    {
+        /* mask1 = (zeta < 0), mask2 = g is odd */
+        c1 = (U32)(zeta >> 31);
+        mask1 = c1;
+        c2 = g & 1;
+        mask2 = 0 - c2;
+        /* if g is odd: g -= f, or g += f when zeta >= 0 */
+        x = (f ^ mask1) - mask1;
+        y = (u ^ mask1) - mask1;
+        z = (v ^ mask1) - mask1;
+        g += x & mask2;
+        q += y & mask2;
+        r += z & mask2;
+        /* if zeta < 0 and g is odd: zeta = -zeta-2 and (f,g) = (g,g-f) */
+        mask1 &= mask2;
+        zeta = (S32)(((U32)zeta ^ mask1) - 1);
+        f += g & mask1;
+        u += q & mask1;
+        v += r & mask1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (S32)u;
+    t->v = (S32)v;
+    t->q = (S32)q;
+    t->r = (S32)r;
+    return zeta;
+}
+
+/* [d,e] = t*[d,e]/2**30 mod BPO, keeping both in (-2*BPO, BPO) */
+static void eco_UpdateDE30(S32 *d, S32 *e, const ECO_TRANS *t)
+{
+    const S32 u = t->u, v = t->v, q = t->q, r = t->r;
+    S32 di, ei, md, me, sd, se;
+    S64 cd, ce;
+    int i;
+
+    /* Add BPO*[u,q] if d is negative and BPO*[v,r] if e is negative */
+    sd = d[8] >> 31;
+    se = e[8] >> 31;
+    md = (u & sd) + (v & se);
+    me = (q & sd) + (r & se);
+
+    di = d[0];
+    ei = e[0];
+    cd = (S64)u*di + (S64)v*ei;
+    ce = (S64)q*di + (S64)r*ei;
+
+    /* Pick md,me so the low 30 bits of t*[d,e] + BPO*[md,me] are zero */
+    md -= (S32)((BPO_INV30 * (U32)cd + (U32)md) & ECO_M30);
+    me -= (S32)((BPO_INV30 * (U32)ce + (U32)me) & ECO_M30);
+
+    cd += (S64)_s30_BPO[0]*md;
+    ce += (S64)_s30_BPO[0]*me;
+    cd >>= 30;
+    ce >>= 30;
+
+    for (i = 1; i < ECO_LIMBS; i++)
+    {
+        di = d[i];
+        ei = e[i];
+        cd += (S64)u*di + (S64)v*ei + (S64)_s30_BPO[i]*md;
+        ce += (S64)q*di + (S64)r*ei + (S64)_s30_BPO[i]*me;
+        d[i-1] = (S32)cd & ECO_M30;
+        e[i-1] = (S32)ce & ECO_M30;
+        cd >>= 30;
+        ce >>= 30;
+    }
+    d[8] = (S32)cd;
+    e[8] = (S32)ce;
+}
+
+/* [f,g] = t*[f,g]/2**30 */
+static void eco_UpdateFG30(S32 *f, S32 *g, const ECO_TRANS *t)
+{
+    const S32 u = t->u, v = t->v, q = t->q, r = t->r;
+    S32 fi, gi;
+    S64 cf, cg;
+    int i;
+
+    fi = f[0];
+    gi = g[0];
+    cf = (S64)u*fi + (S64)v*gi;
+    cg = (S64)q*fi + (S64)r*gi;
+    cf >>= 30;
+    cg >>= 30;
+
+    for (i = 1; i < ECO_LIMBS; i++)
+    {
+        fi = f[i];
+        gi = g[i];
+        cf += (S64)u*fi + (S64)v*gi;
+        cg += (S64)q*fi + (S64)r*gi;
+        f[i-1] = (S32)cf & ECO_M30;
+        g[i-1] = (S32)cg & ECO_M30;
+        cf >>= 30;
+        cg >>= 30;
+    }
+    f[8] = (S32)cf;
+    g[8] = (S32)cg;
+}
+
+/* Bring r from (-2*BPO, BPO) to [0, BPO), negated if sign < 0 */
+static void eco_NormalizeS30(S32 *r, S32 sign)
+{
+    S32 cond_add, cond_neg;
+    int i;
+
+    cond_add = r[8] >> 31;
+    cond_neg = sign >> 31;
+    for (i = 0; i < ECO_LIMBS; i++)
+    {
+        r[i] += _s30_BPO[i] & cond_add;
+        r[i] = (r[i] ^ cond_neg) - cond_neg;
+    }
+    for (i = 0; i < ECO_LIMBS-1; i++)
+    {
+        r[i+1] += r[i] >> 30;
+        r[i] &= ECO_M30;
+    }
+
+    /* Now in (-BPO, BPO) */
+    cond_add = r[8] >> 31;
+    for (i = 0; i < ECO_LIMBS; i++)
+        r[i] += _s30_BPO[i] & cond_add;
+    for (i = 0; i < ECO_LIMBS-1; i++)
+    {
+        r[i+1] += r[i] >> 30;
+        r[i] &= ECO_M30;
+    }
+}
+
+/* Calculate Y = 1/X mod BPO. Constant-time; 1/0 returns 0. */
+void eco_InvModBPO(OUT U_WORD *Y, IN const U_WORD *X)
+{
+    S32 d[ECO_LIMBS] = { 0 }, e[ECO_LIMBS] = { 1 }, f[ECO_LIMBS], g[ECO_LIMBS];
+    S32 zeta = -1;                  /* delta = 1/2 */
+    U_WORD x[K_WORDS];
+    ECO_TRANS t;
+    int i;
+    ECP_COUNT(ECO_OP_INVERSE);
+
+    ecp_Copy(x, X);
+    eco_Mod(x);
+    eco_ToS30(g, x);
+    for (i = 0; i < ECO_LIMBS; i++) f[i] = _s30_BPO[i];
+
+    for (i = 0; i < 20; i++)
+    {
+        zeta = eco_Divsteps30(zeta, (U32)f[0], (U32)g[0], &t);
+        eco_UpdateDE30(d, e, &t);
+        eco_UpdateFG30(f, g, &t);
+    }
+
+    /* g = 0 and f = +/-1; d = +/-1/X */
+    eco_NormalizeS30(d, f[8]);
+    eco_FromS30(Y, d);
+}
+
+/* -- batch inversion ------------------------------------------------------- */
+
+/* x = X mod BPO, with 0 replaced by 1; returns all-ones mask if X was 0 */
+static U_WORD eco_NonZero(U_WORD *x, const U_WORD *X)
+{
+    U_WORD t = 0, m;
+    int i;
+    ecp_Copy(x, X);
+    eco_Mod(x);
+    for (i = 0; i < K_WORDS; i++) t |= x[i];
+    m = ((t | (0 - t)) >> (ECO_WBITS - 1)) - 1;
+    x[0] |= m & 1;
+    return m;
+}
+
+/* 
+    Y[i] = 1/X[i] mod BPO for count scalars of K_WORDS words each, using
+    Montgomery's trick: one eco_InvModBPO and 3 multiplies per scalar.
+    Zero inputs return zero without spoiling the rest. Y and X must not
+    overlap.
+*/
+void eco_BatchInvModBPO(OUT U_WORD *Y, IN const U_WORD *X, IN int count)
+{
+    U_WORD acc[K_WORDS], x[K_WORDS], m;
+    int i, j;
+    ECP_COUNT(ECO_OP_BATCH_INVERSE);
+
+    if (count <= 0) return;
+
+    /* Y[i] = x[0]*...*x[i-1] */
+    ecp_SetValue(acc, 1);
+    for (i = 0; i < count; i++)
+    {
+        ecp_Copy(Y + i*K_WORDS, acc);
+        eco_NonZero(x, X + i*K_WORDS);
+        eco_MulReduce(acc, acc, x);
+    }
+
+    eco_InvModBPO(acc, acc);
+
+    for (i = count - 1; i >= 0; i--)
+    {
+        m = eco_NonZero(x, X + i*K_WORDS);
+        eco_MulReduce(Y + i*K_WORDS, Y + i*K_WORDS, acc);
+        eco_MulReduce(acc, acc, x);
+        eco_Mod(Y + i*K_WORDS);
+        for (j = 0; j < K_WORDS; j++) Y[i*K_WORDS + j] &= ~m;
+    }
+}
@@ -78,6 +78,7 @@ U8* ecp_EncodeInt(OUT U8 *Y, IN const U32 *X, IN U8 parity)
 {
     int i;
     M32 m;
+    ECP_COUNT(ECP_OP_ENCODE);
     
     for (i = 0; i < 28;)
     {
@@ -101,6 +102,7 @@ U8 ecp_DecodeInt(OUT U32 *Y, IN const U8 *X)
 {
     int i;
     M32 m;
+    ECP_COUNT(ECP_OP_DECODE);
     
     for (i = 0; i < 7; i++)
     {
@@ -126,6 +128,7 @@ void ecp_4Folds(U8* Y, const U32* X)
 {
     int i, j;
     U8 a, b;
+    ECP_COUNT(ECP_OP_4FOLDS);
     for (i = 32; i-- > 0; Y++)
     {
         a = 0;
@@ -145,9 +148,80 @@ void ecp_8Folds(U8* Y, const U32* X)
 {
     int i, j;
     U8 a = 0;
+    ECP_COUNT(ECP_OP_8FOLDS);
     for (i = 32; i-- > 0;)
     {
         for (j = 8; j-- > 0;) a = (a << 1) + ((X[j] >> i) & 1);
         *Y++ = a;
     }
 }
+
+/*
+    Signed-digit folding, X must be odd.
+    With K = (X >> 1) + 2^255, X = SUM((2*k_i - 1)*2^i): each bit of K 
+    selects +2^i or -2^i. A slice is then +/-(P_n + SUM(+/-P_i)) where the
+    top limb n fixes the sign, so only half of the permutations are needed.
+    Output: Y[i] = (neg << n) | index of the P_n + SUM(+/-P_i) entry.
+*/
+static void ecp_SignedK(U32* K, const U32* X)
+{
+    int i;
+    for (i = 0; i < 7; i++) K[i] = (X[i] >> 1) | (X[i+1] << 31);
+    K[7] = (X[7] >> 1) | 0x80000000;
+}
+
+void ecp_4SignedFolds(U8* Y, const U32* X)
+{
+    int i;
+    U32 K[8];
+    ecp_SignedK(K, X);
+    ecp_4Folds(Y, K);
+    for (i = 0; i < 64; i++) Y[i] ^= 0x08 ^ (((Y[i] >> 3) - 1) & 0x07);
+}
+
+void ecp_8SignedFolds(U8* Y, const U32* X)
+{
+    int i;
+    U32 K[8];
+    ecp_SignedK(K, X);
+    ecp_8Folds(Y, K);
+    for (i = 0; i < 32; i++) Y[i] ^= 0x80 ^ (((Y[i] >> 7) - 1) & 0x7F);
+}
+
+#if ECP_COUNT_OPS
+/* -- operation counters (see curve25519_mehdi.h) --------------------------- */
+
+ECP_THREAD_LOCAL U64 ecp_op_count[ECP_OP_COUNT];
+
+static const char * const ecp_op_names[ECP_OP_COUNT] =
+{
+    "ecp_Add", "ecp_Sub", "ecp_AddReduce", "ecp_SubReduce", "ecp_Mod",
+    "ecp_WordMulAddReduce", "ecp_Mul", "ecp_MulReduce", "ecp_SqrReduce",
+    "ecp_MulMod", "ecp_SrqMulReduce", "ecp_ModExp2523", "ecp_Inverse",
+    "ecp_EncodeInt", "ecp_DecodeInt", "ecp_4Folds", "ecp_8Folds",
+    "eco_ReduceHiWord", "eco_Reduce512", "eco_MulReduce", "eco_MulAddReduce",
+    "eco_AddReduce", "eco_Mod", "eco_MontMul", "eco_DigestToWords",
+    "eco_ExpModBPO", "eco_InvModBPO", "eco_BatchInvModBPO",
+    "edp_DoublePoint", "edp_AddPoint", "edp_AddAffinePoint", 
+    "edp_AddBasePoint", "edp_ExtPoint2PE", "edp_ScanSlice", 
+    "ed25519_CalculateX", "edp_BasePointMult", "edp_PolyPointMultiply",
+    "ecp_MontDouble", "ecp_Mont", "SHA512 block", "SHA512 block x4"
+};
+
+void ecp_OpCounts_Snapshot(ECP_OP_COUNTS *counts)
+{
+    int i;
+    for (i = 0; i < ECP_OP_COUNT; i++) counts->n[i] = ecp_op_count[i];
+}
+
+void ecp_OpCounts_Reset(void)
+{
+    int i;
+    for (i = 0; i < ECP_OP_COUNT; i++) ecp_op_count[i] = 0;
+}
+
+const char *ecp_OpName(int op)
+{
+    return (op >= 0 && op < ECP_OP_COUNT) ? ecp_op_names[op] : "?";
+}
+#endif
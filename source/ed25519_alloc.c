@@ -0,0 +1,242 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../include/external_calls.h"
+#include "../include/ed25519_signature.h"
+#include "curve25519_mehdi.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#elif defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+/*
+    Context allocation for the Init/Finish functions.
+
+    By default contexts come from mem_alloc/mem_free. ed25519_SetAllocator()
+    replaces them at runtime; the built-in slab arena below is one option.
+
+    Arena layout: every slab is EDP_SLAB_SIZE bytes, aligned to its own
+    size, and serves a single block size (a multiple of 64 bytes). The
+    slab header sits in the first 64 bytes, so the owner slab of any
+    block is found by masking its address. Freed blocks go on a per-size
+    free list. Slabs are only returned by ed25519_Arena_Destroy().
+*/
+
+static ed25519_alloc_fn edp_alloc_fn = 0;
+static ed25519_free_fn edp_free_fn = 0;
+static void *edp_alloc_user = 0;
+
+void ed25519_SetAllocator(
+    ed25519_alloc_fn alloc_fn,          /* IN: null or allocate function */
+    ed25519_free_fn free_fn,            /* IN: null or free function */
+    void *user)                         /* IN: passed to alloc_fn and free_fn */
+{
+    if (alloc_fn == 0 || free_fn == 0)
+    {
+        alloc_fn = 0;
+        free_fn = 0;
+        user = 0;
+    }
+    edp_alloc_fn = alloc_fn;
+    edp_free_fn = free_fn;
+    edp_alloc_user = user;
+}
+
+void *edp_Alloc(size_t size)
+{
+    return edp_alloc_fn ? edp_alloc_fn(edp_alloc_user, size) : mem_alloc(size);
+}
+
+void edp_Free(void *ptr)
+{
+    if (edp_free_fn)
+        edp_free_fn(edp_alloc_user, ptr);
+    else
+        mem_free(ptr);
+}
+
+/* -- slab arena ------------------------------------------------------------ */
+
+#define EDP_SLAB_SIZE       (2*1024*1024)   /* one huge page */
+#define EDP_ARENA_ALIGN     64
+#define EDP_ARENA_CLASSES   64              /* blocks of 64 bytes .. 4 KB */
+
+#define EDP_SLAB_HUGETLB    1               /* explicit huge page */
+#define EDP_SLAB_MAPPED     2               /* THP candidate */
+#define EDP_SLAB_HEAP       3
+
+typedef struct EDP_SLAB_s
+{
+    struct EDP_SLAB_s *next;                /* all slabs of the arena */
+    size_t block;                           /* block size served by slab */
+    U8 *top;                                /* end of blocks handed out */
+    int kind;
+} EDP_SLAB;
+
+typedef struct
+{
+    EDP_SLAB *slabs;
+    EDP_SLAB *current[EDP_ARENA_CLASSES];   /* slab being carved per size */
+    void *free_list[EDP_ARENA_CLASSES];
+    long lock;
+} EDP_ARENA;
+
+static EDP_SLAB *edp_SlabAlloc(size_t block)
+{
+    EDP_SLAB *slab;
+    U8 *p;
+    int kind;
+
+#if defined(__linux__)
+    p = (U8*)mmap(0, EDP_SLAB_SIZE, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    kind = EDP_SLAB_HUGETLB;
+    if (p == (U8*)MAP_FAILED)
+    {
+        /* No reserved huge pages: map twice the size, keep the aligned
+           middle and ask for a transparent huge page */
+        U8 *q = (U8*)mmap(0, 2*EDP_SLAB_SIZE, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (q == (U8*)MAP_FAILED) return 0;
+        p = (U8*)(((size_t)q + EDP_SLAB_SIZE - 1) & ~(size_t)(EDP_SLAB_SIZE - 1));
+        if (p != q) munmap(q, p - q);
+        if (p + EDP_SLAB_SIZE != q + 2*EDP_SLAB_SIZE)
+            munmap(p + EDP_SLAB_SIZE, (q + 2*EDP_SLAB_SIZE) - (p + EDP_SLAB_SIZE));
+#ifdef MADV_HUGEPAGE
+        madvise(p, EDP_SLAB_SIZE, MADV_HUGEPAGE);
+#endif
+        kind = EDP_SLAB_MAPPED;
+    }
+#elif defined(_MSC_VER)
+    p = (U8*)_aligned_malloc(EDP_SLAB_SIZE, EDP_SLAB_SIZE);
+    if (p == 0) return 0;
+    kind = EDP_SLAB_HEAP;
+#else
+    if (posix_memalign((void**)&p, EDP_SLAB_SIZE, EDP_SLAB_SIZE)) return 0;
+    kind = EDP_SLAB_HEAP;
+#endif
+
+    slab = (EDP_SLAB*)p;
+    slab->next = 0;
+    slab->block = block;
+    slab->top = p + EDP_ARENA_ALIGN;
+    slab->kind = kind;
+    return slab;
+}
+
+static void edp_SlabFree(EDP_SLAB *slab)
+{
+    /* Blocks may have held secret keys */
+    mem_clear(slab, slab->top - (U8*)slab);
+#if defined(__linux__)
+    munmap(slab, EDP_SLAB_SIZE);
+#elif defined(_MSC_VER)
+    _aligned_free(slab);
+#else
+    free(slab);
+#endif
+}
+
+/* Returns null if out of memory */
+void *ed25519_Arena_Create(void)
+{
+    EDP_ARENA *arena = (EDP_ARENA*)mem_alloc(sizeof(EDP_ARENA));
+    if (arena) mem_clear(arena, sizeof(EDP_ARENA));
+    return arena;
+}
+
+/* Release all slabs of the arena, including blocks still in use */
+void ed25519_Arena_Destroy(void *arena)
+{
+    EDP_ARENA *a = (EDP_ARENA*)arena;
+    EDP_SLAB *slab;
+
+    if (a == 0) return;
+    while ((slab = a->slabs) != 0)
+    {
+        a->slabs = slab->next;
+        edp_SlabFree(slab);
+    }
+    mem_free(a);
+}
+
+/* 64-byte aligned block of up to 4 KB; null if too large or out of memory */
+void *ed25519_Arena_Alloc(void *arena, size_t size)
+{
+    EDP_ARENA *a = (EDP_ARENA*)arena;
+    EDP_SLAB *slab;
+    size_t block;
+    void *p;
+    int n;
+
+    if (size == 0) size = 1;
+    n = (int)((size + EDP_ARENA_ALIGN - 1) / EDP_ARENA_ALIGN) - 1;
+    if (n >= EDP_ARENA_CLASSES) return 0;
+    block = (size_t)(n + 1)*EDP_ARENA_ALIGN;
+
+    EDP_LOCK(&a->lock);
+    if ((p = a->free_list[n]) != 0)
+    {
+        a->free_list[n] = *(void**)p;
+    }
+    else
+    {
+        slab = a->current[n];
+        if (slab == 0 || slab->top + block > (U8*)slab + EDP_SLAB_SIZE)
+        {
+            if ((slab = edp_SlabAlloc(block)) != 0)
+            {
+                slab->next = a->slabs;
+                a->slabs = slab;
+                a->current[n] = slab;
+            }
+        }
+        if (slab)
+        {
+            p = slab->top;
+            slab->top += block;
+        }
+    }
+    EDP_UNLOCK(&a->lock);
+    return p;
+}
+
+/* Return a block to its size list */
+void ed25519_Arena_Free(void *arena, void *ptr)
+{
+    EDP_ARENA *a = (EDP_ARENA*)arena;
+    EDP_SLAB *slab;
+    int n;
+
+    if (ptr == 0) return;
+    slab = (EDP_SLAB*)((size_t)ptr & ~(size_t)(EDP_SLAB_SIZE - 1));
+    n = (int)(slab->block / EDP_ARENA_ALIGN) - 1;
+
+    EDP_LOCK(&a->lock);
+    *(void**)ptr = a->free_list[n];
+    a->free_list[n] = ptr;
+    EDP_UNLOCK(&a->lock);
+}
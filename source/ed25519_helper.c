@@ -0,0 +1,209 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../include/external_calls.h"
+#include "../include/ed25519_signature.h"
+#include "curve25519_mehdi.h"
+
+/*
+ * -- Low-latency mode -------------------------------------------------------
+ *
+ * Dedicated helper threads spin on their own cache line waiting for a job.
+ * A caller claims an idle helper (IDLE -> CLAIMED), stores the job and
+ * publishes it (POSTED), does its own half of the work and spins until the
+ * helper reports DONE. No locks or system calls on the hot path.
+ * Each helper needs a free core: with fewer cores the spins fall back to
+ * sched_yield() and a hand-off costs a context switch.
+ */
+#ifndef ECP_THREADS
+#define ECP_THREADS         0
+#endif
+
+#if ECP_THREADS && (defined(__unix__) || defined(__APPLE__))
+#define EDP_HELPER_PTHREADS
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#ifdef EDP_HELPER_PTHREADS
+
+#define EDP_MAX_HELPERS     8
+#define EDP_SPIN_LIMIT      4096        /* spins before yielding the core */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define EDP_PAUSE()         __builtin_ia32_pause()
+#else
+#define EDP_PAUSE()
+#endif
+
+enum { EDP_HELPER_IDLE, EDP_HELPER_CLAIMED, EDP_HELPER_POSTED, 
+       EDP_HELPER_DONE, EDP_HELPER_EXIT };
+
+typedef struct
+{
+    int state;
+    edp_helper_fn fn;
+    void *arg;
+    U8 pad[64 - sizeof(int) - sizeof(edp_helper_fn) - sizeof(void*)];
+} EDP_HELPER;
+
+static EDP_HELPER edp_helpers[EDP_MAX_HELPERS];
+static pthread_t edp_helper_tid[EDP_MAX_HELPERS];
+static int edp_helper_count = 0;
+
+/* Wait until *state == value */
+static void edp_SpinWait(int *state, int value)
+{
+    int spins = 0;
+    while (__atomic_load_n(state, __ATOMIC_ACQUIRE) != value)
+    {
+        EDP_PAUSE();
+        if (++spins == EDP_SPIN_LIMIT)
+        {
+            spins = 0;
+            sched_yield();
+        }
+    }
+}
+
+static void *edp_HelperLoop(void *p)
+{
+    EDP_HELPER *h = (EDP_HELPER*)p;
+    int s, spins = 0;
+
+    for (;;)
+    {
+        s = __atomic_load_n(&h->state, __ATOMIC_ACQUIRE);
+        if (s == EDP_HELPER_POSTED)
+        {
+            h->fn(h->arg);
+            __atomic_store_n(&h->state, EDP_HELPER_DONE, __ATOMIC_RELEASE);
+            spins = 0;
+        }
+        else if (s == EDP_HELPER_EXIT)
+            break;
+        else
+        {
+            EDP_PAUSE();
+            if (++spins == EDP_SPIN_LIMIT)
+            {
+                spins = 0;
+                sched_yield();
+            }
+        }
+    }
+    return 0;
+}
+
+void *edp_Helper_Post(edp_helper_fn fn, void *arg)
+{
+    int i, idle, n = __atomic_load_n(&edp_helper_count, __ATOMIC_ACQUIRE);
+    EDP_HELPER *h;
+
+    for (i = 0; i < n; i++)
+    {
+        h = &edp_helpers[i];
+        idle = EDP_HELPER_IDLE;
+        if (__atomic_compare_exchange_n(&h->state, &idle, EDP_HELPER_CLAIMED, 
+                0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            h->fn = fn;
+            h->arg = arg;
+            __atomic_store_n(&h->state, EDP_HELPER_POSTED, __ATOMIC_RELEASE);
+            return h;
+        }
+    }
+    return 0;
+}
+
+void edp_Helper_Join(void *helper)
+{
+    EDP_HELPER *h = (EDP_HELPER*)helper;
+
+    edp_SpinWait(&h->state, EDP_HELPER_DONE);
+    __atomic_store_n(&h->state, EDP_HELPER_IDLE, __ATOMIC_RELEASE);
+}
+
+int ed25519_LowLatency_Start(int helpers)
+{
+    int n = edp_helper_count;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (n > 0) return n;
+    /* A helper without a core of its own only adds context switches */
+    if (cores > 0 && helpers > cores - 1) helpers = (int)(cores - 1);
+    while (n < helpers && n < EDP_MAX_HELPERS)
+    {
+        edp_helpers[n].state = EDP_HELPER_IDLE;
+        if (pthread_create(&edp_helper_tid[n], 0, edp_HelperLoop, &edp_helpers[n]) != 0)
+            break;
+        n++;
+    }
+    __atomic_store_n(&edp_helper_count, n, __ATOMIC_RELEASE);
+    return n;
+}
+
+void ed25519_LowLatency_Stop(void)
+{
+    int i, idle, n = edp_helper_count;
+
+    __atomic_store_n(&edp_helper_count, 0, __ATOMIC_RELEASE);
+    for (i = 0; i < n; i++)
+    {
+        /* wait for a job posted before the count dropped */
+        do
+        {
+            edp_SpinWait(&edp_helpers[i].state, EDP_HELPER_IDLE);
+            idle = EDP_HELPER_IDLE;
+        } while (!__atomic_compare_exchange_n(&edp_helpers[i].state, &idle, 
+                    EDP_HELPER_EXIT, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+        pthread_join(edp_helper_tid[i], 0);
+    }
+}
+
+#else
+
+void *edp_Helper_Post(edp_helper_fn fn, void *arg)
+{
+    (void)fn; (void)arg;
+    return 0;
+}
+
+void edp_Helper_Join(void *helper)
+{
+    (void)helper;
+}
+
+int ed25519_LowLatency_Start(int helpers)
+{
+    (void)helpers;
+    return 0;
+}
+
+void ed25519_LowLatency_Stop(void)
+{
+}
+
+#endif /* EDP_HELPER_PTHREADS */
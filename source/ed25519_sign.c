@@ -27,6 +27,16 @@
 #include "../include/ed25519_signature.h"
 #include "sha512.h"
 
+#ifndef ECP_THREADS
+#define ECP_THREADS         0
+#endif
+
+#if ECP_THREADS && (defined(__unix__) || defined(__APPLE__))
+#define EDP_POOL_PTHREADS
+#include <pthread.h>
+#include <time.h>
+#endif
+
 /*
  * Arithmetic on twisted Edwards curve y^2 - x^2 = 1 + dx^2y^2
  * with d = -(121665/121666) mod p
@@ -61,7 +71,38 @@ const U_WORD _w_2d[K_WORDS] = /* 2*d */
 const U_WORD _w_di[K_WORDS] = /* 1/d */
     W256(0xCDC9F843,0x25E0F276,0x4279542E,0x0B5DD698,0xCDB9CF66,0x2B162114,0x14D5CE43,0x40907ED2);
 
+const PA_POINT _w_base_multiples[2] =
+{
+  { /* 0*P */
+    W256(0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000),
+    W256(0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000),
+    W256(0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000)
+  },
+  { /* 1*P */
+    W256(0xF58C3B85,0x2FBC93C6,0xFB8C0E19,0xCF932DC6,0x643D42C2,0x270B4898,0x33D4BA65,0x07CF9D3A),
+    W256(0xD740913E,0x9D103905,0xD140BEB3,0xFD399F05,0x688F8A09,0xA5C18434,0x98F81267,0x44FD2F92),
+    W256(0x877AAA68,0xABC91205,0xCCAAC49E,0x26D9E823,0xDD43598C,0x5A1B7DCB,0x9F0C65A8,0x6F117B68)
+  }
+};
+
+/*
+    Folding tables are generated by custom_tool (signed digits, 128 entries).
+    With ECP_BASE_TABLES > 1 all comb tables come from base_comb.h in the 
+    build directory. The small-footprint profile uses the 8-entry 4-fold
+    table of base_folding4.h in the build directory, or builds it at first
+    use (ECP_SMALL_FOOTPRINT=2).
+*/
+#if ECP_SMALL_FOOTPRINT == 1
+#include "base_folding4.h"
+#elif ECP_SMALL_FOOTPRINT == 0
+#if ECP_BASE_TABLES > 1
+#include "base_comb.h"
+#else
 #include "base_folding8.h"
+#endif
+#endif
+
+#define ECP_COMB_SPAN   (ECP_BASE_SLICES/ECP_BASE_TABLES)
 
 /*
     Reference: http://eprint.iacr.org/2008/522
@@ -71,12 +112,13 @@ const U_WORD _w_di[K_WORDS] = /* 1/d */
 void edp_AddBasePoint(Ext_POINT *p)
 {
     U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_ADD_BASE);
 
     ecp_SubReduce(a, p->y, p->x);           /* A = (Y1-X1)*(Y2-X2) */
-    ecp_MulReduce(a, a, _w_base_folding8[1].YmX);
+    ecp_MulReduce(a, a, _w_base_multiples[1].YmX);
     ecp_AddReduce(b, p->y, p->x);           /* B = (Y1+X1)*(Y2+X2) */
-    ecp_MulReduce(b, b, _w_base_folding8[1].YpX);
-    ecp_MulReduce(c, p->t, _w_base_folding8[1].T2d); /* C = T1*2d*T2 */
+    ecp_MulReduce(b, b, _w_base_multiples[1].YpX);
+    ecp_MulReduce(c, p->t, _w_base_multiples[1].T2d); /* C = T1*2d*T2 */
     ecp_AddReduce(d, p->z, p->z);           /* D = 2*Z1 */
     ecp_SubReduce(e, b, a);                 /* E = B-A */
     ecp_AddReduce(b, b, a);                 /* H = B+A */
@@ -97,6 +139,7 @@ void edp_AddBasePoint(Ext_POINT *p)
 void edp_AddAffinePoint(Ext_POINT *p, const PA_POINT *q)
 {
     U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_ADD_AFFINE);
     ecp_SubReduce(a, p->y, p->x);           /* A = (Y1-X1)*(Y2-X2) */
     ecp_MulReduce(a, a, q->YmX);
     ecp_AddReduce(b, p->y, p->x);           /* B = (Y1+X1)*(Y2+X2) */
@@ -114,6 +157,32 @@ void edp_AddAffinePoint(Ext_POINT *p, const PA_POINT *q)
     ecp_MulReduce(p->z, d, a);              /* G*F */
 }
 
+/*
+    Assumptions: pre-computed q, q->Z=1
+    Cost: 7M + 7add
+    Return: P = P - Q, -Q = (YmX, YpX, -T2d)
+*/
+void edp_SubAffinePoint(Ext_POINT *p, const PA_POINT *q)
+{
+    U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_ADD_AFFINE);
+    ecp_SubReduce(a, p->y, p->x);           /* A = (Y1-X1)*(Y2+X2) */
+    ecp_MulReduce(a, a, q->YpX);
+    ecp_AddReduce(b, p->y, p->x);           /* B = (Y1+X1)*(Y2-X2) */
+    ecp_MulReduce(b, b, q->YmX);
+    ecp_MulReduce(c, p->t, q->T2d);         /* C = T1*2d*T2 */
+    ecp_AddReduce(d, p->z, p->z);           /* D = Z1*2*Z2 (Z2=1)*/
+    ecp_SubReduce(e, b, a);                 /* E = B-A */
+    ecp_AddReduce(b, b, a);                 /* H = B+A */
+    ecp_AddReduce(a, d, c);                 /* F = D+C */
+    ecp_SubReduce(d, d, c);                 /* G = D-C */
+
+    ecp_MulReduce(p->x, e, a);              /* E*F */
+    ecp_MulReduce(p->y, b, d);              /* H*G */
+    ecp_MulReduce(p->t, e, b);              /* E*H */
+    ecp_MulReduce(p->z, d, a);              /* G*F */
+}
+
 /*
     Reference: http://eprint.iacr.org/2008/522
     Cost: 4M + 4S + 7add
@@ -122,6 +191,7 @@ void edp_AddAffinePoint(Ext_POINT *p, const PA_POINT *q)
 void edp_DoublePoint(Ext_POINT *p)
 {
     U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_DOUBLE);
 
     ecp_SqrReduce(a, p->x);         /* A = X1^2 */
     ecp_SqrReduce(b, p->y);         /* B = Y1^2 */
@@ -209,25 +279,245 @@ void edp_DoublePoint(Ext_POINT *p)
 //       | 31|  | 30|            | 1 |  | 0 |   P0
 //       +---+  +---+    ....    +---+  +---+
 // cut[]:  0      1      ....      30     31
+//
+//    Slices use signed digits (see ecp_8SignedFolds): each bit of the odd
+//    multiplier stands for +/-2^i, so a slice is +/-(P7 + SUM(+/-P_i)) and
+//    tables only hold the 128 combinations with +P7. The sign is applied
+//    with a constant-time conditional negate.
+//
+//    With n comb tables, table k holds the combinations of (2^(k*w))*P_i
+//    where w = 32/n. Slices cut[i-k*w] are added from table k in the same
+//    step, so only w-1 doublings are needed for the same 32 additions.
 // --------------------------------------------------------------------------
-// Return S = a*P where P is ed25519 base point and R is random
 */
-void edp_BasePointMult(
+
+/*
+// --------------------------------------------------------------------------
+//    Table lookup: the slice index comes from the secret scalar, so a direct
+//    load of table[index] leaks it through the cache. With ECP_CT_LOOKUP
+//    (default) every entry (128, or 8 in the small-footprint profile) is 
+//    read and the wanted one is
+//    kept with a mask. The AVX2 scan keeps the point in three ymm registers
+//    and costs 3 loads + 3 and/or per entry.
+// --------------------------------------------------------------------------
+*/
+#if !defined(ECP_NO_AVX2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EDP_SCAN_AVX2
+#include <immintrin.h>
+#endif
+
+/* p = table[index] for index in [0,ECP_BASE_ENTRIES-1], reads all entries */
+static void edp_ScanSlice_C(PA_POINT *p, const PA_POINT *table, U32 index)
+{
+    int i, j;
+    U_WORD m;
+
+    for (j = 0; j < K_WORDS; j++) p->YpX[j] = p->YmX[j] = p->T2d[j] = 0;
+
+    for (i = 0; i < ECP_BASE_ENTRIES; i++)
+    {
+        m = (U_WORD)0 - (U_WORD)((((U32)i ^ index) - 1) >> 31);
+        for (j = 0; j < K_WORDS; j++)
+        {
+            p->YpX[j] |= table[i].YpX[j] & m;
+            p->YmX[j] |= table[i].YmX[j] & m;
+            p->T2d[j] |= table[i].T2d[j] & m;
+        }
+    }
+}
+
+#ifdef EDP_SCAN_AVX2
+__attribute__((target("avx2")))
+static void edp_ScanSlice_AVX2(PA_POINT *p, const PA_POINT *table, U32 index)
+{
+    int i;
+    __m256i m0, m1;
+    __m256i a = _mm256_setzero_si256(), b = a, c = a;
+    __m256i k0 = a, k1 = _mm256_set1_epi32(1);
+    const __m256i idx = _mm256_set1_epi32((int)index);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i *t = (const __m256i*)table;
+
+    /* two entries per step: k0 = i, k1 = i+1 */
+    for (i = 0; i < ECP_BASE_ENTRIES; i += 2, t += 6)
+    {
+        m0 = _mm256_cmpeq_epi32(k0, idx);
+        m1 = _mm256_cmpeq_epi32(k1, idx);
+        a = _mm256_or_si256(a, _mm256_and_si256(m0, _mm256_loadu_si256(t+0)));
+        b = _mm256_or_si256(b, _mm256_and_si256(m0, _mm256_loadu_si256(t+1)));
+        c = _mm256_or_si256(c, _mm256_and_si256(m0, _mm256_loadu_si256(t+2)));
+        a = _mm256_or_si256(a, _mm256_and_si256(m1, _mm256_loadu_si256(t+3)));
+        b = _mm256_or_si256(b, _mm256_and_si256(m1, _mm256_loadu_si256(t+4)));
+        c = _mm256_or_si256(c, _mm256_and_si256(m1, _mm256_loadu_si256(t+5)));
+        k0 = _mm256_add_epi32(k0, two);
+        k1 = _mm256_add_epi32(k1, two);
+    }
+    _mm256_storeu_si256((__m256i*)p->YpX, a);
+    _mm256_storeu_si256((__m256i*)p->YmX, b);
+    _mm256_storeu_si256((__m256i*)p->T2d, c);
+}
+
+static void edp_ScanSlice_Select(PA_POINT *p, const PA_POINT *table, U32 index);
+static void (*edp_scan_slice)(PA_POINT *p, const PA_POINT *table, U32 index) = edp_ScanSlice_Select;
+
+/* Pick the scan on first use */
+static void edp_ScanSlice_Select(PA_POINT *p, const PA_POINT *table, U32 index)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        edp_scan_slice = edp_ScanSlice_AVX2;
+    else
+        edp_scan_slice = edp_ScanSlice_C;
+    edp_scan_slice(p, table, index);
+}
+#else
+#define edp_scan_slice  edp_ScanSlice_C
+#endif
+
+/* Constant-time: p = table[index], index in [0,ECP_BASE_ENTRIES-1] */
+void edp_ScanSlice(PA_POINT *p, const PA_POINT *table, U32 index)
+{
+    ECP_COUNT(EDP_OP_LOOKUP);
+    edp_scan_slice(p, table, index);
+}
+
+/* p = +/-table[index] for slice = (neg << (folds-1)) | index */
+static void edp_SignedSlice(PA_POINT *p, const PA_POINT *table, U8 slice)
+{
+    int i;
+    U_WORD t[K_WORDS], x, m = (U_WORD)0 - (slice / ECP_BASE_ENTRIES);
+#if ECP_CT_LOOKUP
+    PA_POINT e;
+    const PA_POINT *q = &e;
+
+    ECP_COUNT(EDP_OP_LOOKUP);
+    edp_scan_slice(&e, table, slice & (ECP_BASE_ENTRIES-1));
+#else
+    const PA_POINT *q = &table[slice & (ECP_BASE_ENTRIES-1)];
+#endif
+
+    /* Constant-time conditional negate */
+    ecp_SubReduce(t, _w_maxP, q->T2d);      /* -T2d */
+    for (i = 0; i < K_WORDS; i++)
+    {
+        x = (q->YpX[i] ^ q->YmX[i]) & m;    /* swap YpX/YmX */
+        p->YpX[i] = q->YpX[i] ^ x;
+        p->YmX[i] = q->YmX[i] ^ x;
+        p->T2d[i] = q->T2d[i] ^ ((q->T2d[i] ^ t[i]) & m);
+    }
+}
+
+#if ECP_SMALL_FOOTPRINT > 1
+/*
+    Base table built at first use: P3 + SUM(+/-P0,..,+/-P2) where 
+    P_i = 2^(64i)*BasePoint, same entries as custom_tool's base_folding4.h.
+    The first caller moves edp_base_state from IDLE to BUILDING and
+    builds the table; concurrent first callers spin until it is READY
+    (release-store after the last entry is written).
+*/
+enum { EDP_BASE_IDLE, EDP_BASE_BUILDING, EDP_BASE_READY };
+
+#ifdef EDP_POOL_PTHREADS
+#include <sched.h>
+#define EDP_YIELD()         sched_yield()
+#else
+#define EDP_YIELD()
+#endif
+
+static PA_POINT _w_base_folding4[8];
+static int edp_base_state = EDP_BASE_IDLE;
+
+/* Ext (X:Y:Z:T) to pre-computed affine (y+x, y-x, 2d*x*y) */
+static void edp_Ext2PA(PA_POINT *r, Ext_POINT *p)
+{
+    ecp_Inverse(p->z, p->z);
+    ecp_MulMod(p->x, p->x, p->z);
+    ecp_MulMod(p->y, p->y, p->z);
+    ecp_MulMod(p->t, p->x, p->y);
+
+    ecp_AddReduce(r->YpX, p->y, p->x); ecp_Mod(r->YpX);
+    ecp_SubReduce(r->YmX, p->y, p->x); ecp_Mod(r->YmX);
+    ecp_MulMod(r->T2d, p->t, _w_2d);
+}
+
+static void edp_BuildBaseTable(PA_POINT *table)
+{
+    int i, j;
+    Ext_POINT S, T;
+    PE_POINT P[3];
+    const PA_POINT *B = &_w_base_multiples[1];
+
+    ecp_SubReduce(S.x, B->YpX, B->YmX);     /* 2x */
+    ecp_AddReduce(S.y, B->YpX, B->YmX);     /* 2y */
+    ecp_MulReduce(S.t, B->T2d, _w_di);      /* 2xy */
+    ecp_SetValue(S.z, 2);                   /* 2z */
+
+    for (i = 0; i < 3; i++)
+    {
+        edp_ExtPoint2PE(&P[i], &S);
+        for (j = 0; j < 64; j++) edp_DoublePoint(&S);
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        T = S;                              /* P3 */
+        for (j = 0; j < 3; j++)
+        {
+            if (i & (1 << j))
+                edp_AddPoint(&T, &T, &P[j]);
+            else
+                edp_SubPoint(&T, &T, &P[j]);
+        }
+        edp_Ext2PA(&table[i], &T);
+    }
+}
+
+const PA_POINT *edp_BaseTable(void)
+{
+    int idle = EDP_BASE_IDLE;
+
+    if (__atomic_load_n(&edp_base_state, __ATOMIC_ACQUIRE) != EDP_BASE_READY)
+    {
+        if (__atomic_compare_exchange_n(&edp_base_state, &idle, EDP_BASE_BUILDING,
+                0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            edp_BuildBaseTable(_w_base_folding4);
+            __atomic_store_n(&edp_base_state, EDP_BASE_READY, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            while (__atomic_load_n(&edp_base_state, __ATOMIC_ACQUIRE) != EDP_BASE_READY)
+                EDP_YIELD();
+        }
+    }
+    return _w_base_folding4;
+}
+#endif /* ECP_SMALL_FOOTPRINT > 1 */
+
+/*
+    S = comb slices [first, last) of cut, evaluated Horner style and
+    shifted into place by the doublings of the slices after last.
+    R randomizes the starting point.
+*/
+static void edp_CombRange(
     OUT Ext_POINT *S, 
-    IN const U_WORD *sk, 
+    IN const U8 *cut, 
+    IN int first, 
+    IN int last, 
     IN const U_WORD *R)
 {
-    int i = 1;
-    U8 cut[32];
-    const PA_POINT *p0;
-
-    ecp_8Folds(cut, sk);
+    int i = first;
+    PA_POINT p;
+    const PA_POINT *base = edp_BaseTable();
+#if ECP_BASE_TABLES > 1
+    int k;
+#endif
 
-    p0 = &_w_base_folding8[cut[0]];
+    edp_SignedSlice(&p, base, cut[i]);
 
-    ecp_SubReduce(S->x, p0->YpX, p0->YmX);  /* 2x */
-    ecp_AddReduce(S->y, p0->YpX, p0->YmX);  /* 2y */
-    ecp_MulReduce(S->t, p0->T2d, _w_di);    /* 2xy */
+    ecp_SubReduce(S->x, p.YpX, p.YmX);      /* 2x */
+    ecp_AddReduce(S->y, p.YpX, p.YmX);      /* 2y */
+    ecp_MulReduce(S->t, p.T2d, _w_di);      /* 2xy */
 
     /* Randomize starting point */
 
@@ -236,31 +526,121 @@ void edp_BasePointMult(
     ecp_MulReduce(S->t, S->t, R);           /* T = 2xyR */
     ecp_MulReduce(S->y, S->y, R);           /* Y = 2yR */
 
-    do 
+#if ECP_BASE_TABLES > 1
+    for (k = 1; k < ECP_BASE_TABLES; k++)
+    {
+        edp_SignedSlice(&p, _w_base_comb8[k], cut[i-k*ECP_COMB_SPAN]);
+        edp_AddAffinePoint(S, &p);
+    }
+#endif
+
+    while (++i < last)
     {
         edp_DoublePoint(S);
-        edp_AddAffinePoint(S, &_w_base_folding8[cut[i]]);
-    } while (i++ < 31);
+        edp_SignedSlice(&p, base, cut[i]);
+        edp_AddAffinePoint(S, &p);
+#if ECP_BASE_TABLES > 1
+        for (k = 1; k < ECP_BASE_TABLES; k++)
+        {
+            edp_SignedSlice(&p, _w_base_comb8[k], cut[i-k*ECP_COMB_SPAN]);
+            edp_AddAffinePoint(S, &p);
+        }
+#endif
+    }
+    while (i++ < ECP_BASE_SLICES) edp_DoublePoint(S);
 }
 
-void edp_BasePointMultiply(
-    OUT Affine_POINT *R, 
+/*
+    Low-latency split: a helper takes the first EDP_COMB_SPLIT slices
+    (plus the doublings that shift them), the caller takes the rest.
+    With doubling ~ addition the two halves cost about the same when
+    split = span*tables/(2*tables+1).
+*/
+#define ECP_COMB_FIRST  (ECP_BASE_SLICES - ECP_COMB_SPAN)
+#define EDP_COMB_SPLIT  (ECP_COMB_SPAN*ECP_BASE_TABLES/(2*ECP_BASE_TABLES+1))
+
+typedef struct
+{
+    Ext_POINT S;
+    const U8 *cut;
+    const U_WORD *R;
+} EDP_COMB_JOB;
+
+static void edp_CombJob(void *arg)
+{
+    EDP_COMB_JOB *job = (EDP_COMB_JOB*)arg;
+    edp_CombRange(&job->S, job->cut, ECP_COMB_FIRST, ECP_COMB_FIRST + EDP_COMB_SPLIT, job->R);
+}
+
+/* Return S = a*P where P is ed25519 base point and R is random */
+void edp_BasePointMult(
+    OUT Ext_POINT *S, 
+    IN const U_WORD *sk, 
+    IN const U_WORD *R)
+{
+    int j;
+    U8 cut[ECP_BASE_SLICES];
+    U_WORD t[K_WORDS], u[K_WORDS], m;
+    EDP_COMB_JOB job;
+    PE_POINT q;
+    void *helper;
+    ECP_COUNT(EDP_OP_BASE_MULT);
+
+    /* Signed folding needs an odd multiplier: t = sk mod BPO, +BPO if even */
+    ecp_Copy(t, sk);
+    eco_Mod(t);
+    ecp_Add(u, t, _w_BPO);
+    m = (t[0] & 1) - 1;
+    for (j = 0; j < K_WORDS; j++) t[j] ^= (t[j] ^ u[j]) & m;
+
+    ecp_BaseSignedFolds(cut, t);
+
+    job.cut = cut;
+    job.R = R;
+    helper = edp_Helper_Post(edp_CombJob, &job);
+    if (helper == 0)
+    {
+        edp_CombRange(S, cut, ECP_COMB_FIRST, ECP_BASE_SLICES, R);
+        return;
+    }
+
+    edp_CombRange(S, cut, ECP_COMB_FIRST + EDP_COMB_SPLIT, ECP_BASE_SLICES, R);
+    edp_ExtPoint2PE(&q, S);
+    edp_Helper_Join(helper);
+    edp_AddPoint(S, &job.S, &q);
+
+    mem_clear(&job.S, sizeof(job.S));
+    mem_clear(&q, sizeof(q));
+}
+
+/* Return S = sk*P in projective coordinates, blinded if requested */
+static void edp_BlindedBasePointMult(
+    OUT Ext_POINT *S, 
     IN const U_WORD *sk, 
     IN const void *blinding)
 {
-    Ext_POINT S;
     U_WORD t[K_WORDS];
 
     if (blinding)
     {
         eco_AddReduce(t, sk, ((EDP_BLINDING_CTX*)blinding)->bl);
-        edp_BasePointMult(&S, t, ((EDP_BLINDING_CTX*)blinding)->zr);
-        edp_AddPoint(&S, &S, &((EDP_BLINDING_CTX*)blinding)->BP);
+        edp_BasePointMult(S, t, ((EDP_BLINDING_CTX*)blinding)->zr);
+        edp_AddPoint(S, S, &((EDP_BLINDING_CTX*)blinding)->BP);
     }
     else
     {
-        edp_BasePointMult(&S, sk, edp_custom_blinding.zr);
+        edp_BasePointMult(S, sk, edp_custom_blinding.zr);
     }
+}
+
+void edp_BasePointMultiply(
+    OUT Affine_POINT *R, 
+    IN const U_WORD *sk, 
+    IN const void *blinding)
+{
+    Ext_POINT S;
+
+    edp_BlindedBasePointMult(&S, sk, blinding);
 
     ecp_Inverse(S.z, S.z);
     ecp_MulMod(R->x, S.x, S.z);
@@ -269,6 +649,7 @@ void edp_BasePointMultiply(
 
 void edp_ExtPoint2PE(PE_POINT *r, const Ext_POINT *p)
 {
+    ECP_COUNT(EDP_OP_TO_PE);
     ecp_AddReduce(r->YpX, p->y, p->x);
     ecp_SubReduce(r->YmX, p->y, p->x);
     ecp_MulReduce(r->T2d, p->t, _w_2d);
@@ -294,24 +675,25 @@ void *ed25519_Blinding_Init(
     struct {
         Ext_POINT T;
         U_WORD t[K_WORDS];
-        SHA512_CTX H;
         U8 digest[SHA512_DIGEST_LENGTH];
     } d;
 
     EDP_BLINDING_CTX *ctx = (EDP_BLINDING_CTX*)context;
+    EDP_TRACE_ENTRY(Blinding_Init, context, size);
 
     if (ctx == 0)
     {
-        ctx = (EDP_BLINDING_CTX*)mem_alloc(sizeof(EDP_BLINDING_CTX));
-        if (ctx == 0) return 0;
+        ctx = (EDP_BLINDING_CTX*)edp_Alloc(sizeof(EDP_BLINDING_CTX));
+        if (ctx == 0)
+        {
+            EDP_TRACE_EXIT(Blinding_Init, 0, size);
+            return 0;
+        }
     }
 
     /* Use edp_custom_blinding to protect generation of the new blinder */
 
-    SHA512_Init(&d.H);
-    SHA512_Update(&d.H, edp_custom_blinding.zr, 32);
-    SHA512_Update(&d.H, seed, size);
-    SHA512_Final(d.digest, &d.H);
+    SHA512_Hdr32(d.digest, edp_custom_blinding.zr, seed, size);
 
     ecp_BytesToWords(ctx->zr, d.digest+32);
     ecp_BytesToWords(d.t, d.digest);
@@ -326,18 +708,50 @@ void *ed25519_Blinding_Init(
 
     /* clear potentially sensitive data */
     mem_clear (&d, sizeof(d));
-
+
+    EDP_TRACE_EXIT(Blinding_Init, ctx, size);
     return ctx;
 }
 
+/*
+ * Re-randomize a blinding context without a new base point multiply:
+ *   bl' = 2*bl mod BPO, BP' = 2*BP  (BP' = -bl'*P still holds)
+ *   zr' = zr^2
+ * Cost: 1 doubling + 6M, against a SHA-512 and a full multiply for
+ * ed25519_Blinding_Init().
+ */
+void ed25519_Blinding_Refresh(
+    void *context)                      /* IO: blinding context */
+{
+    EDP_BLINDING_CTX *ctx = (EDP_BLINDING_CTX*)context;
+    Ext_POINT T;
+    EDP_TRACE_ENTRY(Blinding_Refresh, context, 0);
+
+    /* (Y+X, Y-X, 2Z) -> (2X : 2Y : 2Z) */
+    ecp_SubReduce(T.x, ctx->BP.YpX, ctx->BP.YmX);
+    ecp_AddReduce(T.y, ctx->BP.YpX, ctx->BP.YmX);
+    ecp_Copy(T.z, ctx->BP.Z2);
+    edp_DoublePoint(&T);
+    edp_ExtPoint2PE(&ctx->BP, &T);
+
+    eco_AddReduce(ctx->bl, ctx->bl, ctx->bl);
+    eco_Mod(ctx->bl);
+    ecp_SqrReduce(ctx->zr, ctx->zr);
+
+    mem_clear(&T, sizeof(T));
+    EDP_TRACE_EXIT(Blinding_Refresh, context, 0);
+}
+
 void ed25519_Blinding_Finish(
     void *context)                      /* IN: blinding context */
 {
+    EDP_TRACE_ENTRY(Blinding_Finish, context, 0);
     if (context)
     {
         mem_clear (context, sizeof(EDP_BLINDING_CTX));
-        mem_free (context);
+        edp_Free(context);
     }
+    EDP_TRACE_EXIT(Blinding_Finish, context, 0);
 }
 
 /* Generate public and private key pair associated with the secret key */
@@ -349,13 +763,11 @@ void ed25519_CreateKeyPair(
 {
     U8 md[SHA512_DIGEST_LENGTH];
     U_WORD t[K_WORDS];
-    SHA512_CTX H;
     Affine_POINT Q;
+    EDP_TRACE_ENTRY(CreateKeyPair, sk, 0);
 
     /* [a:b] = H(sk) */
-    SHA512_Init(&H);
-    SHA512_Update(&H, sk, 32);
-    SHA512_Final(md, &H);
+    SHA512_32(md, sk);
     ecp_TrimSecretKey(md);
 
     ecp_BytesToWords(t, md);
@@ -364,56 +776,714 @@ void ed25519_CreateKeyPair(
 
     memcpy(privKey, sk, 32);
     memcpy(privKey+32, pubKey, 32);
+    EDP_TRACE_EXIT(CreateKeyPair, sk, 0);
 }
 
 /*
- * Generate message signature
+ * -- Additive key derivation ----------------------------------------------
+ *
+ * child = parent + tweak*B. Derived points are encoded in groups of
+ * EDP_KEY_BATCH sharing one inversion (1 inversion + 3(n-1) multiplications).
  */
-void ed25519_SignMessage(
-    unsigned char *signature,           /* OUT: [64 bytes] signature (R,S) */
-    const unsigned char *privKey,       /*  IN: [64 bytes] private key (sk,pk) */
-    const void *blinding,               /*  IN: [optional] null or blinding context */
-    const unsigned char *msg,           /*  IN: [msg_size bytes] message to sign */
-    size_t msg_size)
+#define EDP_KEY_BATCH   16
+
+static void edp_EncodePoints(U8 *keys, const Ext_POINT *P, int n)
+{
+    U_WORD c[EDP_KEY_BATCH][K_WORDS], t[K_WORDS], u[K_WORDS];
+    Affine_POINT A;
+    int i;
+
+    /* c[i] = P[0].z * ... * P[i].z */
+    ecp_Copy(c[0], P[0].z);
+    for (i = 1; i < n; i++) ecp_MulReduce(c[i], c[i-1], P[i].z);
+
+    ecp_Inverse(t, c[n-1]);
+    for (i = n-1; i >= 0; i--)
+    {
+        if (i > 0)
+        {
+            ecp_MulReduce(u, t, c[i-1]);    /* 1/P[i].z */
+            ecp_MulReduce(t, t, P[i].z);
+        }
+        else
+            ecp_Copy(u, t);
+
+        ecp_MulMod(A.x, P[i].x, u);
+        ecp_MulMod(A.y, P[i].y, u);
+        ed25519_PackPoint(keys + 32*i, A.y, A.x[0]);
+    }
+}
+
+static void edp_KeyToExt(Ext_POINT *P, const U8 *key)
+{
+    Affine_POINT A;
+
+    ed25519_UnpackPoint(&A, key);
+    ecp_Copy(P->x, A.x);
+    ecp_Copy(P->y, A.y);
+    ecp_SetValue(P->z, 1);
+    ecp_MulReduce(P->t, A.x, A.y);
+}
+
+/* t = tweak mod BPO */
+static void edp_TweakToWords(U_WORD *t, const U8 *tweak)
+{
+    U_WORD w[2*K_WORDS];
+
+    ecp_BytesToWords(w, tweak);
+    memset(w + K_WORDS, 0, K_WORDS*sizeof(U_WORD));
+    eco_Reduce512(t, w);
+}
+
+/* Untraced; also used by ed25519_DerivePublicKey and ed25519_Sign_Derive */
+static void edp_DerivePublicKeys(
+    U8 *childKeys,
+    const U8 *parentKey,
+    const U8 *tweaks,
+    size_t count)
+{
+    Ext_POINT P[EDP_KEY_BATCH];
+    PE_POINT A;
+    U_WORD t[K_WORDS];
+    size_t i;
+    int j, n;
+
+    edp_KeyToExt(&P[0], parentKey);
+    edp_ExtPoint2PE(&A, &P[0]);
+
+    for (i = 0; i < count; i += n)
+    {
+        n = (count - i < EDP_KEY_BATCH) ? (int)(count - i) : EDP_KEY_BATCH;
+        for (j = 0; j < n; j++)
+        {
+            edp_TweakToWords(t, tweaks + 32*(i+j));
+            edp_BlindedBasePointMult(&P[j], t, 0);
+            edp_AddPoint(&P[j], &P[j], &A);
+        }
+        edp_EncodePoints(childKeys + 32*i, P, n);
+    }
+}
+
+void ed25519_DerivePublicKeys(
+    unsigned char *childKeys,           /* OUT: [count*32 bytes] child public keys */
+    const unsigned char *parentKey,     /*  IN: [32 bytes] parent public key */
+    const unsigned char *tweaks,        /*  IN: [count*32 bytes] tweaks */
+    size_t count)                       /*  IN: number of keys */
+{
+    EDP_TRACE_ENTRY(DerivePublicKeys, parentKey, count);
+    edp_DerivePublicKeys(childKeys, parentKey, tweaks, count);
+    EDP_TRACE_EXIT(DerivePublicKeys, parentKey, count);
+}
+
+void ed25519_DerivePublicKey(
+    unsigned char *childKey,            /* OUT: [32 bytes] child public key */
+    const unsigned char *parentKey,     /*  IN: [32 bytes] parent public key */
+    const unsigned char *tweak)         /*  IN: [32 bytes] tweak */
+{
+    EDP_TRACE_ENTRY(DerivePublicKey, parentKey, 1);
+    edp_DerivePublicKeys(childKey, parentKey, tweak, 1);
+    EDP_TRACE_EXIT(DerivePublicKey, parentKey, 1);
+}
+
+void *ed25519_KeySeq_Init(
+    void *context,                      /* IO: null or key sequence context */
+    const unsigned char *startKey)      /*  IN: [32 bytes] public key */
+{
+    Ext_POINT *P = (Ext_POINT*)context;
+    EDP_TRACE_ENTRY(KeySeq_Init, context, 0);
+
+    if (P == 0)
+    {
+        P = (Ext_POINT*)edp_Alloc(sizeof(Ext_POINT));
+        if (P == 0)
+        {
+            EDP_TRACE_EXIT(KeySeq_Init, 0, 0);
+            return 0;
+        }
+    }
+    edp_KeyToExt(P, startKey);
+    EDP_TRACE_EXIT(KeySeq_Init, P, 0);
+    return P;
+}
+
+void ed25519_KeySeq_Next(
+    void *context,                      /*  IN: created by ed25519_KeySeq_Init */
+    unsigned char *pubKeys,             /* OUT: [count*32 bytes] next public keys */
+    size_t count)                       /*  IN: number of keys */
+{
+    Ext_POINT P[EDP_KEY_BATCH], *S = (Ext_POINT*)context;
+    size_t i;
+    int j, n;
+    EDP_TRACE_ENTRY(KeySeq_Next, context, count);
+
+    for (i = 0; i < count; i += n)
+    {
+        n = (count - i < EDP_KEY_BATCH) ? (int)(count - i) : EDP_KEY_BATCH;
+        for (j = 0; j < n; j++)
+        {
+            edp_AddBasePoint(S);        /* k -> k+1 */
+            memcpy(&P[j], S, sizeof(Ext_POINT));
+        }
+        edp_EncodePoints(pubKeys + 32*i, P, n);
+    }
+    EDP_TRACE_EXIT(KeySeq_Next, context, count);
+}
+
+void ed25519_KeySeq_Finish(
+    void *context)                      /* IN: key sequence context */
+{
+    EDP_TRACE_ENTRY(KeySeq_Finish, context, 0);
+    if (context)
+    {
+        mem_clear(context, sizeof(Ext_POINT));
+        edp_Free(context);
+    }
+    EDP_TRACE_EXIT(KeySeq_Finish, context, 0);
+}
+
+/* Untraced body of ed25519_Sign_Init, shared with ed25519_SignMessage */
+static void edp_Sign_Expand(
+    EDP_SIGN_CTX *ctx,
+    const U8 *privKey,
+    const void *blinding)
 {
-    SHA512_CTX H;
-    Affine_POINT R;
-    U_WORD a[K_WORDS], t[K_WORDS], r[K_WORDS];
     U8 md[SHA512_DIGEST_LENGTH];
 
     /* [a:b] = H(sk) */
-    SHA512_Init(&H);
-    SHA512_Update(&H, privKey, 32);
-    SHA512_Final(md, &H);
+    SHA512_32(md, privKey);
     ecp_TrimSecretKey(md);              /* a = first 32 bytes */
-    ecp_BytesToWords(a, md);
+    ecp_BytesToWords(ctx->a, md);
+    memcpy(ctx->b, md+32, 32);
+    memcpy(ctx->pk, privKey+32, 32);
+    ctx->blinding = blinding;
+
+    mem_clear(md, sizeof(md));
+}
+
+/*
+ * Expand private key once for signing multiple messages.
+ * blinding context (if any) must remain valid until ed25519_Sign_Finish().
+ */
+void *ed25519_Sign_Init(
+    void *context,                      /* IO: null or ptr signing context */
+    const unsigned char *privKey,       /* IN: [64 bytes] private key (sk,pk) */
+    const void *blinding)               /* IN: [optional] null or blinding context */
+{
+    EDP_SIGN_CTX *ctx = (EDP_SIGN_CTX*)context;
+    EDP_TRACE_ENTRY(Sign_Init, context, 0);
+
+    if (ctx == 0)
+    {
+        ctx = (EDP_SIGN_CTX*)edp_Alloc(sizeof(EDP_SIGN_CTX));
+        if (ctx == 0)
+        {
+            EDP_TRACE_EXIT(Sign_Init, 0, 0);
+            return 0;
+        }
+    }
+
+    edp_Sign_Expand(ctx, privKey, blinding);
+    EDP_TRACE_EXIT(Sign_Init, ctx, 0);
+    return ctx;
+}
+
+/*
+ * Signing context for the child key of ed25519_DerivePublicKey():
+ *   a' = a + tweak mod BPO, b' = H(b + tweak)
+ */
+void *ed25519_Sign_Derive(
+    void *context,                      /* IO: null or signing context to use */
+    const void *parent,                 /* IN: created by ed25519_Sign_Init */
+    const unsigned char *tweak)         /* IN: [32 bytes] tweak */
+{
+    const EDP_SIGN_CTX *p = (const EDP_SIGN_CTX*)parent;
+    EDP_SIGN_CTX *ctx = (EDP_SIGN_CTX*)context;
+    U8 md[SHA512_DIGEST_LENGTH];
+    U_WORD t[K_WORDS];
+    EDP_TRACE_ENTRY(Sign_Derive, context, 0);
+
+    if (ctx == 0)
+    {
+        ctx = (EDP_SIGN_CTX*)edp_Alloc(sizeof(EDP_SIGN_CTX));
+        if (ctx == 0)
+        {
+            EDP_TRACE_EXIT(Sign_Derive, 0, 0);
+            return 0;
+        }
+    }
+
+    edp_TweakToWords(t, tweak);
+    eco_AddReduce(ctx->a, p->a, t);
+    eco_Mod(ctx->a);
+    SHA512_Hdr32(md, p->b, tweak, 32);
+    memcpy(ctx->b, md, 32);
+    edp_DerivePublicKeys(ctx->pk, p->pk, tweak, 1);
+    ctx->blinding = p->blinding;
+
+    mem_clear(md, sizeof(md));
+    ecp_SetValue(t, 0);
+    EDP_TRACE_EXIT(Sign_Derive, ctx, 0);
+    return ctx;
+}
+
+/* Untraced body of ed25519_Sign_WithCtx, shared with ed25519_SignMessage */
+static void edp_Sign_WithCtx(
+    const EDP_SIGN_CTX *ctx,
+    U8 *signature,
+    const U8 *msg,
+    size_t msg_size)
+{
+    Affine_POINT R;
+    U_WORD t[K_WORDS], r[K_WORDS];
+    U8 md[SHA512_DIGEST_LENGTH];
 
     /* r = H(b + m) mod BPO */
-    SHA512_Init(&H);
-    SHA512_Update(&H, md+32, 32);
-    SHA512_Update(&H, msg, msg_size);
-    SHA512_Final(md, &H);
+    SHA512_Hdr32(md, ctx->b, msg, msg_size);
     eco_DigestToWords(r, md);
     eco_Mod(r);                         /* r mod BPO */
 
     /* R = r*P */
-    edp_BasePointMultiply(&R, r, blinding);
+    edp_BasePointMultiply(&R, r, ctx->blinding);
     ed25519_PackPoint(signature, R.y, R.x[0]); /* R part of signature */
 
     /* S = r + H(encoded(R) + pk + m) * a  mod BPO */
+    SHA512_Hdr64(md, signature, ctx->pk, msg, msg_size); /* encoded(R), pk, m */
+    eco_DigestToWords(t, md);
+
+    eco_MulAddReduce(t, t, ctx->a, r);  /* h()*a + r */
+    eco_Mod(t);
+    ecp_WordsToBytes(signature+32, t);  /* S part of signature */
+
+    /* Clear sensitive data */
+    ecp_SetValue(r, 0);
+}
+
+/*
+ * Generate message signature using expanded key
+ */
+void ed25519_Sign_WithCtx(
+    const void *context,                /*  IN: created by ed25519_Sign_Init */
+    unsigned char *signature,           /* OUT: [64 bytes] signature (R,S) */
+    const unsigned char *msg,           /*  IN: [msg_size bytes] message to sign */
+    size_t msg_size)
+{
+    EDP_TRACE_ENTRY(Sign_WithCtx, context, msg_size);
+    edp_Sign_WithCtx((const EDP_SIGN_CTX*)context, signature, msg, msg_size);
+    EDP_TRACE_EXIT(Sign_WithCtx, context, msg_size);
+}
+
+/*
+ * Sign up to ED25519_SIGN_BATCH messages:
+ *  - nonces r = H(b + m) and H(encoded(R) + pk + m) are calculated in
+ *    parallel using multi-buffer SHA-512
+ *  - all R = r*P are converted to affine using a single inversion
+ *    (Montgomery's trick: 1 inversion + 3(n-1) multiplications)
+ */
+#define ED25519_SIGN_BATCH  16
+
+static void ed25519_SignChunk(
+    const EDP_SIGN_CTX *ctx,
+    unsigned char * const *signatures,
+    const unsigned char * const *msgs,
+    const size_t *msg_sizes,
+    int n)
+{
+    struct {
+        SHA512_MB_MGR mgr;
+        SHA512_MB_JOB job[ED25519_SIGN_BATCH];
+        Ext_POINT R[ED25519_SIGN_BATCH];
+        U_WORD r[ED25519_SIGN_BATCH][K_WORDS];
+        U_WORD c[ED25519_SIGN_BATCH][K_WORDS];
+        U_WORD t[K_WORDS], u[K_WORDS];
+        Affine_POINT A;
+    } d;
+    int i;
+
+    /* r = H(b + m) mod BPO */
+    SHA512_MB_Init(&d.mgr);
+    for (i = 0; i < n; i++)
+    {
+        memcpy(d.job[i].prefix, ctx->b, 32);
+        d.job[i].prefix_len = 32;
+        d.job[i].data = msgs[i];
+        d.job[i].len = msg_sizes[i];
+        SHA512_MB_Submit(&d.mgr, &d.job[i]);
+    }
+    while (SHA512_MB_Flush(&d.mgr)) ;
+
+    /* R = r*P, c[i] = R[0].z * ... * R[i].z */
+    for (i = 0; i < n; i++)
+    {
+        eco_DigestToWords(d.r[i], d.job[i].md);
+        eco_Mod(d.r[i]);
+        edp_BlindedBasePointMult(&d.R[i], d.r[i], ctx->blinding);
+        if (i == 0)
+            ecp_Copy(d.c[0], d.R[0].z);
+        else
+            ecp_MulReduce(d.c[i], d.c[i-1], d.R[i].z);
+    }
+
+    /* t = 1/(R[0].z * ... * R[i].z), walking backwards */
+    ecp_Inverse(d.t, d.c[n-1]);
+    for (i = n-1; i >= 0; i--)
+    {
+        if (i > 0)
+        {
+            ecp_MulReduce(d.u, d.t, d.c[i-1]);  /* 1/R[i].z */
+            ecp_MulReduce(d.t, d.t, d.R[i].z);
+        }
+        else
+            ecp_Copy(d.u, d.t);
+
+        ecp_MulMod(d.A.x, d.R[i].x, d.u);
+        ecp_MulMod(d.A.y, d.R[i].y, d.u);
+        ed25519_PackPoint(signatures[i], d.A.y, d.A.x[0]);  /* R part */
+    }
+
+    /* S = r + H(encoded(R) + pk + m) * a  mod BPO */
+    for (i = 0; i < n; i++)
+    {
+        memcpy(d.job[i].prefix, signatures[i], 32);
+        memcpy(d.job[i].prefix + 32, ctx->pk, 32);
+        d.job[i].prefix_len = 64;
+        SHA512_MB_Submit(&d.mgr, &d.job[i]);
+    }
+    while (SHA512_MB_Flush(&d.mgr)) ;
+
+    for (i = 0; i < n; i++)
+    {
+        eco_DigestToWords(d.t, d.job[i].md);
+        eco_MulAddReduce(d.t, d.t, ctx->a, d.r[i]);
+        eco_Mod(d.t);
+        ecp_WordsToBytes(signatures[i]+32, d.t);    /* S part */
+    }
+
+    /* Clear sensitive data */
+    mem_clear(&d, sizeof(d));
+}
+
+/*
+ * Sign count messages with the same key. 
+ * Signatures are identical to the ones created by ed25519_Sign_WithCtx().
+ */
+void ed25519_SignBatch(
+    const void *context,                /*  IN: created by ed25519_Sign_Init */
+    unsigned char * const *signatures,  /* OUT: [count] 64-byte signatures (R,S) */
+    const unsigned char * const *msgs,  /*  IN: [count] messages to sign */
+    const size_t *msg_sizes,            /*  IN: [count] message sizes */
+    size_t count)                       /*  IN: number of messages */
+{
+    size_t i;
+    int n;
+    EDP_TRACE_ENTRY(SignBatch, context, count);
+
+    for (i = 0; i < count; i += n)
+    {
+        n = (count - i < ED25519_SIGN_BATCH) ? (int)(count - i) : ED25519_SIGN_BATCH;
+        ed25519_SignChunk((const EDP_SIGN_CTX*)context, 
+            signatures + i, msgs + i, msg_sizes + i, n);
+    }
+    EDP_TRACE_EXIT(SignBatch, context, count);
+}
+
+void ed25519_Sign_Finish(
+    void *context)                      /* IN: signing context */
+{
+    EDP_TRACE_ENTRY(Sign_Finish, context, 0);
+    if (context)
+    {
+        mem_clear (context, sizeof(EDP_SIGN_CTX));
+        edp_Free(context);
+    }
+    EDP_TRACE_EXIT(Sign_Finish, context, 0);
+}
+
+/*
+ * -- Offline/online signing -----------------------------------------------
+ *
+ * Pool entries hold r and encoded(r*B). r = H(b + key + counter) mod BPO
+ * where key = H(seed + instance + address) is unique per pool: the
+ * instance number is taken from a process-wide counter, so two pools never
+ * share a key even if a caller passes the same seed twice. counter is
+ * unique within the pool. Refill computes the entries outside the lock;
+ * the lock only covers the ring indexes.
+ */
+#define EDP_POOL_MAX_THREADS    8
+#define EDP_POOL_MIN_SEED       32
+
+static long edp_pool_lock = 0;
+static U64 edp_pool_instance = 0;
+
+typedef struct
+{
+    U_WORD r[K_WORDS];
+    U8 R[32];
+} EDP_POOL_ENTRY;
+
+typedef struct
+{
+    EDP_SIGN_CTX key;
+    EDP_BLINDING_CTX blinding;          /* copy of key.blinding */
+    U8 seed[32];                        /* H(seed + instance + address) */
+    U64 counter;
+    size_t size, head, count, pending;
+    long lock;
+    EDP_POOL_ENTRY *entries;
+#ifdef EDP_POOL_PTHREADS
+    int running;
+    int threads;
+    pthread_t tid[EDP_POOL_MAX_THREADS];
+#endif
+} EDP_SIGN_POOL;
+
+static void edp_PoolNonce(EDP_SIGN_POOL *pool, EDP_POOL_ENTRY *e, U64 counter)
+{
+    Affine_POINT R;
+    U8 md[SHA512_DIGEST_LENGTH], ctr[8];
+    int i;
+
+    for (i = 0; i < 8; i++) ctr[i] = (U8)(counter >> (8*i));
+
+    /* r = H(b + key + counter) mod BPO */
+    SHA512_Hdr64(md, pool->key.b, pool->seed, ctr, 8);
+    eco_DigestToWords(e->r, md);
+    eco_Mod(e->r);
+
+    /* R = r*P */
+    edp_BasePointMultiply(&R, e->r, pool->key.blinding);
+    ed25519_PackPoint(e->R, R.y, R.x[0]);
+
+    mem_clear(md, sizeof(md));
+}
+
+void *ed25519_SignPool_Init(
+    const void *context,                /* IN: created by ed25519_Sign_Init */
+    size_t entries,                     /* IN: pool capacity */
+    const unsigned char *seed,          /* IN: [seed_size bytes] fresh random seed */
+    size_t seed_size)                   /* IN: size of seed, at least 32 */
+{
+    SHA512_CTX H;
+    U8 md[SHA512_DIGEST_LENGTH], ctr[8];
+    EDP_SIGN_POOL *pool;
+    U64 instance;
+    int i;
+    EDP_TRACE_ENTRY(SignPool_Init, context, entries);
+
+    if (seed_size < EDP_POOL_MIN_SEED)
+    {
+        EDP_TRACE_EXIT(SignPool_Init, 0, entries);
+        return 0;
+    }
+    if (entries == 0) entries = 1;
+    pool = (EDP_SIGN_POOL*)edp_Alloc(sizeof(EDP_SIGN_POOL));
+    if (pool == 0)
+    {
+        EDP_TRACE_EXIT(SignPool_Init, 0, entries);
+        return 0;
+    }
+    memset(pool, 0, sizeof(EDP_SIGN_POOL));
+
+    pool->entries = (EDP_POOL_ENTRY*)edp_Alloc(entries*sizeof(EDP_POOL_ENTRY));
+    if (pool->entries == 0)
+    {
+        edp_Free(pool);
+        EDP_TRACE_EXIT(SignPool_Init, 0, entries);
+        return 0;
+    }
+    memset(pool->entries, 0, entries*sizeof(EDP_POOL_ENTRY));
+    pool->size = entries;
+    memcpy(&pool->key, context, sizeof(EDP_SIGN_CTX));
+
+    /* Refill threads use a private copy: the caller may refresh its
+       blinding context while the pool is in use */
+    if (pool->key.blinding)
+    {
+        memcpy(&pool->blinding, pool->key.blinding, sizeof(EDP_BLINDING_CTX));
+        pool->key.blinding = &pool->blinding;
+    }
+
+    EDP_LOCK(&edp_pool_lock);
+    instance = edp_pool_instance++;
+    EDP_UNLOCK(&edp_pool_lock);
+    for (i = 0; i < 8; i++) ctr[i] = (U8)(instance >> (8*i));
+
     SHA512_Init(&H);
-    SHA512_Update(&H, signature, 32);   /* encoded(R) */
-    SHA512_Update(&H, privKey+32, 32);  /* pk */
-    SHA512_Update(&H, msg, msg_size);   /* m */
+    SHA512_Update(&H, seed, seed_size);
+    SHA512_Update(&H, ctr, 8);
+    SHA512_Update(&H, &pool, sizeof(pool));
     SHA512_Final(md, &H);
+    memcpy(pool->seed, md, 32);
+
+    mem_clear(md, sizeof(md));
+    mem_clear(&H, sizeof(H));
+    EDP_TRACE_EXIT(SignPool_Init, pool, entries);
+    return pool;
+}
+
+/* Untraced; the refill threads call this, not the public API */
+static size_t edp_SignPool_Refill(EDP_SIGN_POOL *pool, size_t count)
+{
+    EDP_POOL_ENTRY e;
+    U64 counter;
+    size_t n;
+
+    for (n = 0; n < count; n++)
+    {
+        EDP_LOCK(&pool->lock);
+        if (pool->count + pool->pending >= pool->size)
+        {
+            EDP_UNLOCK(&pool->lock);
+            break;
+        }
+        counter = pool->counter++;
+        pool->pending++;
+        EDP_UNLOCK(&pool->lock);
+
+        edp_PoolNonce(pool, &e, counter);
+
+        EDP_LOCK(&pool->lock);
+        memcpy(&pool->entries[(pool->head + pool->count) % pool->size], &e, sizeof(e));
+        pool->count++;
+        pool->pending--;
+        EDP_UNLOCK(&pool->lock);
+    }
+
+    mem_clear(&e, sizeof(e));
+    return n;
+}
+
+size_t ed25519_SignPool_Refill(
+    void *p,                            /* IN: signing pool */
+    size_t count)                       /* IN: max entries to add */
+{
+    size_t n;
+    EDP_TRACE_ENTRY(SignPool_Refill, p, count);
+
+    n = edp_SignPool_Refill((EDP_SIGN_POOL*)p, count);
+    EDP_TRACE_EXIT(SignPool_Refill, p, n);
+    return n;
+}
+
+#ifdef EDP_POOL_PTHREADS
+static void *edp_PoolWorker(void *p)
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)p;
+    struct timespec ts = { 0, 1000000 };    /* 1 msec when the pool is full */
+
+    while (__atomic_load_n(&pool->running, __ATOMIC_ACQUIRE))
+    {
+        if (edp_SignPool_Refill(pool, 1) == 0) nanosleep(&ts, 0);
+    }
+    return 0;
+}
+#endif
+
+int ed25519_SignPool_Start(
+    void *p,                            /* IN: signing pool */
+    int threads)                        /* IN: number of refill threads */
+{
+#ifdef EDP_POOL_PTHREADS
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)p;
+    EDP_TRACE_ENTRY(SignPool_Start, p, threads);
+
+    __atomic_store_n(&pool->running, 1, __ATOMIC_RELEASE);
+    while (pool->threads < threads && pool->threads < EDP_POOL_MAX_THREADS)
+    {
+        if (pthread_create(&pool->tid[pool->threads], 0, edp_PoolWorker, pool) != 0) break;
+        pool->threads++;
+    }
+    EDP_TRACE_EXIT(SignPool_Start, p, pool->threads);
+    return pool->threads;
+#else
+    EDP_TRACE_ENTRY(SignPool_Start, p, threads);
+    (void)p; (void)threads;
+    EDP_TRACE_EXIT(SignPool_Start, p, 0);
+    return 0;
+#endif
+}
+
+int ed25519_Sign_FromPool(
+    void *p,                            /* IN: signing pool */
+    unsigned char *signature,           /* OUT: [64 bytes] signature (R,S) */
+    const unsigned char *msg,           /*  IN: [msg_size bytes] message to sign */
+    size_t msg_size)
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)p;
+    EDP_POOL_ENTRY e, *slot;
+    U_WORD t[K_WORDS];
+    U8 md[SHA512_DIGEST_LENGTH];
+    U64 counter = 0;
+    int pooled = 0;
+    EDP_TRACE_ENTRY(Sign_FromPool, p, msg_size);
+
+    EDP_LOCK(&pool->lock);
+    if (pool->count)
+    {
+        slot = &pool->entries[pool->head];
+        memcpy(&e, slot, sizeof(e));
+        mem_clear(slot, sizeof(e));     /* wipe on use */
+        pool->head = (pool->head + 1) % pool->size;
+        pool->count--;
+        pooled = 1;
+    }
+    else
+        counter = pool->counter++;
+    EDP_UNLOCK(&pool->lock);
+
+    if (!pooled) edp_PoolNonce(pool, &e, counter);
+
+    memcpy(signature, e.R, 32);         /* R part of signature */
+
+    /* S = r + H(encoded(R) + pk + m) * a  mod BPO */
+    SHA512_Hdr64(md, signature, pool->key.pk, msg, msg_size);
     eco_DigestToWords(t, md);
 
-    eco_MulReduce(t, t, a);             /* h()*a */
-    eco_AddReduce(t, t, r);
+    eco_MulAddReduce(t, t, pool->key.a, e.r);
     eco_Mod(t);
     ecp_WordsToBytes(signature+32, t);  /* S part of signature */
 
     /* Clear sensitive data */
-    ecp_SetValue(a, 0);
-    ecp_SetValue(r, 0);
+    mem_clear(&e, sizeof(e));
+    EDP_TRACE_EXIT(Sign_FromPool, p, msg_size);
+    return pooled;
+}
+
+void ed25519_SignPool_Finish(
+    void *p)                            /* IN: signing pool */
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)p;
+    EDP_TRACE_ENTRY(SignPool_Finish, p, 0);
+    if (pool)
+    {
+#ifdef EDP_POOL_PTHREADS
+        __atomic_store_n(&pool->running, 0, __ATOMIC_RELEASE);
+        while (pool->threads > 0) pthread_join(pool->tid[--pool->threads], 0);
+#endif
+        mem_clear(pool->entries, pool->size*sizeof(EDP_POOL_ENTRY));
+        edp_Free(pool->entries);
+        mem_clear(pool, sizeof(EDP_SIGN_POOL));
+        edp_Free(pool);
+    }
+    EDP_TRACE_EXIT(SignPool_Finish, p, 0);
+}
+
+/*
+ * Generate message signature
+ */
+void ed25519_SignMessage(
+    unsigned char *signature,           /* OUT: [64 bytes] signature (R,S) */
+    const unsigned char *privKey,       /*  IN: [64 bytes] private key (sk,pk) */
+    const void *blinding,               /*  IN: [optional] null or blinding context */
+    const unsigned char *msg,           /*  IN: [msg_size bytes] message to sign */
+    size_t msg_size)
+{
+    EDP_SIGN_CTX ctx;
+    EDP_TRACE_ENTRY(SignMessage, privKey, msg_size);
+
+    edp_Sign_Expand(&ctx, privKey, blinding);
+    edp_Sign_WithCtx(&ctx, signature, msg, msg_size);
+
+    /* Clear sensitive data */
+    mem_clear(&ctx, sizeof(ctx));
+    EDP_TRACE_EXIT(SignMessage, privKey, msg_size);
 }
@@ -0,0 +1,183 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../include/external_calls.h"
+#include "../include/ed25519_signature.h"
+#include "curve25519_mehdi.h"
+
+/*
+    Per-API latency histograms (ECP_LATENCY=1).
+
+    Log-linear buckets: values below 8 ns have a bucket each, every power
+    of two above is split into 8 buckets (12.5% resolution). Bucket i >= 8
+    starts at (8 + (i & 7)) << ((i >> 3) - 1), the last bucket also holds
+    everything from 2^40 ns up. Recording is one clock read and three
+    relaxed atomic adds: no locks, so any thread may call
+    ed25519_Latency_Snapshot while others are recording. A snapshot is
+    not atomic as a whole; its count may differ slightly from the sum of
+    its buckets.
+*/
+#if ECP_LATENCY
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#include <intrin.h>
+#define EDP_ATOMIC_ADD(p,v) _InterlockedExchangeAdd64((volatile __int64*)(p), (__int64)(v))
+#define EDP_ATOMIC_LOAD(p)  (*(volatile U64*)(p))
+#define EDP_ATOMIC_STORE(p,v) _InterlockedExchange64((volatile __int64*)(p), (__int64)(v))
+#else
+#include <time.h>
+#define EDP_ATOMIC_ADD(p,v) __atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+#define EDP_ATOMIC_LOAD(p)  __atomic_load_n(p, __ATOMIC_RELAXED)
+#define EDP_ATOMIC_STORE(p,v) __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#endif
+
+typedef struct
+{
+    U64 count;
+    U64 total_ns;
+    U64 bucket[ed25519_latency_buckets];
+} EDP_LATENCY;
+
+static EDP_LATENCY edp_latency[EDP_API_COUNT];
+
+static const char *edp_api_names[EDP_API_COUNT] = {
+    "ed25519_Blinding_Init",
+    "ed25519_Blinding_Refresh",
+    "ed25519_Blinding_Finish",
+    "ed25519_CreateKeyPair",
+    "ed25519_DerivePublicKeys",
+    "ed25519_DerivePublicKey",
+    "ed25519_KeySeq_Init",
+    "ed25519_KeySeq_Next",
+    "ed25519_KeySeq_Finish",
+    "ed25519_Sign_Init",
+    "ed25519_Sign_Derive",
+    "ed25519_Sign_WithCtx",
+    "ed25519_SignBatch",
+    "ed25519_Sign_Finish",
+    "ed25519_SignPool_Init",
+    "ed25519_SignPool_Refill",
+    "ed25519_SignPool_Start",
+    "ed25519_Sign_FromPool",
+    "ed25519_SignPool_Finish",
+    "ed25519_SignMessage",
+    "ed25519_VerifySignature",
+    "ed25519_Verify_Init",
+    "ed25519_Verify_InitEx",
+    "ed25519_Verify_Finish",
+    "ed25519_Verify_Check",
+    "ed25519_Verify_CheckBatch",
+    "ed25519_VerifyCache_Init",
+    "ed25519_VerifyCache_Finish",
+    "ed25519_Verify_CheckCached",
+    "curve25519_dh_CalculatePublicKey_fast",
+    "curve25519_dh_CalculatePublicKey",
+    "curve25519_dh_CreateSharedKey"
+};
+
+U64 edp_LatencyNow(void)
+{
+#if defined(_MSC_VER)
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (U64)((double)t.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (U64)ts.tv_sec*1000000000 + (U64)ts.tv_nsec;
+#endif
+}
+
+static int edp_LatencyBucket(U64 ns)
+{
+    int e = 3;
+
+    if (ns < 8) return (int)ns;
+    while (e < 39 && (ns >> (e + 1))) e++;
+    if (ns >> 40) return ed25519_latency_buckets - 1;
+    return 8*(e - 2) + (int)((ns >> (e - 3)) & 7);
+}
+
+void edp_LatencyRecord(int api, U64 start)
+{
+    EDP_LATENCY *h = &edp_latency[api];
+    U64 ns = edp_LatencyNow() - start;
+
+    EDP_ATOMIC_ADD(&h->count, 1);
+    EDP_ATOMIC_ADD(&h->total_ns, ns);
+    EDP_ATOMIC_ADD(&h->bucket[edp_LatencyBucket(ns)], 1);
+}
+
+int ed25519_Latency_Snapshot(
+    ed25519_latency *hist,              /* OUT: [max] histograms */
+    int max)                            /* IN: size of hist */
+{
+    int api, i;
+
+    for (api = 0; api < EDP_API_COUNT && api < max; api++)
+    {
+        hist[api].name = edp_api_names[api];
+        hist[api].count = EDP_ATOMIC_LOAD(&edp_latency[api].count);
+        hist[api].total_ns = EDP_ATOMIC_LOAD(&edp_latency[api].total_ns);
+        for (i = 0; i < ed25519_latency_buckets; i++)
+            hist[api].bucket[i] = EDP_ATOMIC_LOAD(&edp_latency[api].bucket[i]);
+    }
+    return EDP_API_COUNT;
+}
+
+void ed25519_Latency_Reset(void)
+{
+    int api, i;
+
+    for (api = 0; api < EDP_API_COUNT; api++)
+    {
+        EDP_ATOMIC_STORE(&edp_latency[api].count, 0);
+        EDP_ATOMIC_STORE(&edp_latency[api].total_ns, 0);
+        for (i = 0; i < ed25519_latency_buckets; i++)
+            EDP_ATOMIC_STORE(&edp_latency[api].bucket[i], 0);
+    }
+}
+
+#else   /* ECP_LATENCY */
+
+int ed25519_Latency_Snapshot(ed25519_latency *hist, int max)
+{
+    (void)hist; (void)max;
+    return 0;
+}
+
+void ed25519_Latency_Reset(void)
+{
+}
+
+#endif  /* ECP_LATENCY */
+
+unsigned long long ed25519_Latency_BucketStart(int bucket)
+{
+    if (bucket < 8) return (unsigned long long)bucket;
+    return (unsigned long long)(8 + (bucket & 7)) << ((bucket >> 3) - 1);
+}
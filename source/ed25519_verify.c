@@ -41,21 +41,32 @@
  *      l = 0x1000000000000000000000000000000014DEF9DEA2F79CD65812631A5CF5D3ED
  */
 
+#if ECP_SMALL_FOOTPRINT
+#define EDP_Q_SLICES    128     /* 2 folds: Q1 +/- Q0 */
+#define EDP_Q_ENTRIES   2
+#else
+#define EDP_Q_SLICES    64      /* 4 folds: Q3 + SUM(+/-Q0,..,+/-Q2) */
+#define EDP_Q_ENTRIES   8
+#endif
+
 typedef struct {
     unsigned char pk[32];
-    PE_POINT q_table[16];
+    PE_POINT q_table[EDP_Q_ENTRIES];    /* signed digits */
+    PE_POINT q;                 /* Q, correction for even multipliers */
+    U_WORD flags;               /* ed25519_verify_strict, EDP_KEY_REJECTED */
 } EDP_SIGV_CTX;
 
+#define EDP_KEY_REJECTED    0x100   /* strict: public key failed its checks */
+
 extern const U_WORD _w_P[K_WORDS];
 extern const U_WORD _w_di[K_WORDS];
 
-extern const PA_POINT _w_base_folding8[256];
 extern const U_WORD _w_NxBPO[16][K_WORDS];
 
 #define _w_BPO _w_NxBPO[1]
 
-#define _w_Zero     _w_base_folding8[0].T2d
-#define _w_One      _w_base_folding8[0].YpX
+#define _w_Zero     _w_base_multiples[0].T2d
+#define _w_One      _w_base_multiples[0].YpX
 
 const U_WORD _w_I[K_WORDS] = /* sqrt(-1) */
     W256(0x4A0EA0B0,0xC4EE1B27,0xAD2FE478,0x2F431806,0x3DFBD7A7,0x2B4D0099,0x4FC1DF0B,0x2B832480);
@@ -66,6 +77,7 @@ static const U_WORD _w_d[K_WORDS] =
 void ed25519_CalculateX(OUT U_WORD *X, IN const U_WORD *Y, U_WORD parity)
 {
     U_WORD u[K_WORDS], v[K_WORDS], a[K_WORDS], b[K_WORDS];
+    ECP_COUNT(EDP_OP_DECOMPRESS);
 
     /* Calculate sqrt((y^2 - 1)/(d*y^2 + 1)) */
 
@@ -108,6 +120,7 @@ void ed25519_UnpackPoint(Affine_POINT *r, const unsigned char *p)
 void ecp_SrqMulReduce(U_WORD *Z, const U_WORD *X, int n, const U_WORD *Y)
 {
     U_WORD t[K_WORDS];
+    ECP_COUNT(ECP_OP_SQR_MUL);
     ecp_SqrReduce(t, X);
     while (n-- > 1) ecp_SqrReduce(t, t);
     ecp_MulReduce(Z, t, Y);
@@ -117,6 +130,7 @@ void ecp_ModExp2523(U_WORD *Y, const U_WORD *X)
 {
     U_WORD x2[K_WORDS], x9[K_WORDS], x11[K_WORDS], x5[K_WORDS], x10[K_WORDS];
     U_WORD x20[K_WORDS], x50[K_WORDS], x100[K_WORDS], t[K_WORDS];
+    ECP_COUNT(ECP_OP_MOD_EXP);
 
     ecp_SqrReduce(x2, X);                       /* 2 */
     ecp_SrqMulReduce(x9, x2, 2, X);             /* 9 */
@@ -142,6 +156,7 @@ void ecp_ModExp2523(U_WORD *Y, const U_WORD *X)
 void edp_AddPoint(Ext_POINT *r, const Ext_POINT *p, const PE_POINT *q)
 {
     U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_ADD);
 
     ecp_SubReduce(a, p->y, p->x);           /* A = (Y1-X1)*(Y2-X2) */
     ecp_MulReduce(a, a, q->YmX);
@@ -160,31 +175,133 @@ void edp_AddPoint(Ext_POINT *r, const Ext_POINT *p, const PE_POINT *q)
     ecp_MulReduce(r->z, d, a);              /* G*F */
 }
 
-int ed25519_VerifySignature(
-    const unsigned char *signature,             /* IN: signature (R,S) */
-    const unsigned char *publicKey,             /* IN: public key */
-    const unsigned char *msg, size_t msg_size)  /* IN: message to sign */
+/*
+    Assumptions: pre-computed q
+    Cost: 8M + 6add
+    Return: P = P - Q, -Q = (YmX, YpX, -T2d, Z2)
+*/
+void edp_SubPoint(Ext_POINT *r, const Ext_POINT *p, const PE_POINT *q)
 {
-    EDP_SIGV_CTX ctx;
+    U_WORD a[K_WORDS], b[K_WORDS], c[K_WORDS], d[K_WORDS], e[K_WORDS];
+    ECP_COUNT(EDP_OP_ADD);
+
+    ecp_SubReduce(a, p->y, p->x);           /* A = (Y1-X1)*(Y2+X2) */
+    ecp_MulReduce(a, a, q->YpX);
+    ecp_AddReduce(b, p->y, p->x);           /* B = (Y1+X1)*(Y2-X2) */
+    ecp_MulReduce(b, b, q->YmX);
+    ecp_MulReduce(c, p->t, q->T2d);         /* C = T1*2d*T2 */
+    ecp_MulReduce(d, p->z, q->Z2);          /* D = Z1*2*Z2 */
+    ecp_SubReduce(e, b, a);                 /* E = B-A */
+    ecp_AddReduce(b, b, a);                 /* H = B+A */
+    ecp_AddReduce(a, d, c);                 /* F = D+C */
+    ecp_SubReduce(d, d, c);                 /* G = D-C */
+
+    ecp_MulReduce(r->x, e, a);              /* E*F */
+    ecp_MulReduce(r->y, b, d);              /* H*G */
+    ecp_MulReduce(r->t, e, b);              /* E*H */
+    ecp_MulReduce(r->z, d, a);              /* G*F */
+}
 
-    ed25519_Verify_Init(&ctx, publicKey);
+/*
+    Encodings of the small-order points, sign bit ignored. Entries with
+    y >= p are the non-canonical forms of 0, 1 and -1.
+*/
+static const U8 edp_small_order[7][32] = {
+    /* 0 (order 4) */
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    /* 1 (order 1) */
+    { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    /* order 8 */
+    { 0x26,0xe8,0x95,0x8f,0xc2,0xb2,0x27,0xb0,0x45,0xc3,0xf4,0x89,0xf2,0xef,0x98,0xf0,
+      0xd5,0xdf,0xac,0x05,0xd3,0xc6,0x33,0x39,0xb1,0x38,0x02,0x88,0x6d,0x53,0xfc,0x05 },
+    /* order 8 */
+    { 0xc7,0x17,0x6a,0x70,0x3d,0x4d,0xd8,0x4f,0xba,0x3c,0x0b,0x76,0x0d,0x10,0x67,0x0f,
+      0x2a,0x20,0x53,0xfa,0x2c,0x39,0xcc,0xc6,0x4e,0xc7,0xfd,0x77,0x92,0xac,0x03,0x7a },
+    /* p-1 (order 2) */
+    { 0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f },
+    /* p (=0, order 4) */
+    { 0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f },
+    /* p+1 (=1, order 1) */
+    { 0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f }
+};
+
+static int edp_IsSmallOrder(const U8 *p)
+{
+    int i, j;
+    U8 c;
 
-    return ed25519_Verify_Check(&ctx, signature, msg, msg_size);
+    for (i = 0; i < 7; i++)
+    {
+        c = (U8)((p[31] & 0x7F) ^ edp_small_order[i][31]);
+        for (j = 0; j < 31; j++) c |= p[j] ^ edp_small_order[i][j];
+        if (c == 0) return 1;
+    }
+    return 0;
 }
 
-#define QTABLE_SET(d,s) \
-    edp_AddPoint(&T, &Q, &ctx->q_table[s]); \
-    edp_ExtPoint2PE(&ctx->q_table[d], &T)
+/* Canonical encoding (y < p, no -0) of a point on the curve */
+static int edp_IsCanonicalPoint(const U8 *p)
+{
+    U_WORD x[K_WORDS], y[K_WORDS], u[K_WORDS], v[K_WORDS];
+    U8 parity = ecp_DecodeInt(y, p);
+
+    if (ecp_CmpLT(y, _w_P) == 0) return 0;
+
+    ed25519_CalculateX(x, y, 0);
+    if (parity && ecp_CmpNE(x, _w_Zero) == 0) return 0;
+
+    /* x^2*(d*y^2 + 1) == y^2 - 1 */
+    ecp_SqrReduce(u, y);
+    ecp_MulReduce(v, u, _w_d);
+    ecp_SubReduce(u, u, _w_One);
+    ecp_AddReduce(v, v, _w_One);
+    ecp_SqrReduce(x, x);
+    ecp_MulReduce(x, x, v);
+    ecp_SubReduce(x, x, u);
+    ecp_Mod(x);
+    return ecp_CmpNE(x, _w_Zero) == 0;
+}
 
-void * ed25519_Verify_Init(
-    void *context,                      /* IO: null or context buffer to use */
-    const unsigned char *publicKey)     /* IN: [32 bytes] public key */
+/* Strict mode: reject small-order R and S >= BPO before any point math */
+static int edp_StrictReject(const EDP_SIGV_CTX *ctx, const unsigned char *signature)
+{
+    U_WORD s[K_WORDS];
+
+    if ((ctx->flags & ed25519_verify_strict) == 0) return 0;
+    if (ctx->flags & EDP_KEY_REJECTED) return 1;
+    if (edp_IsSmallOrder(signature)) return 1;
+    ecp_BytesToWords(s, signature+32);
+    return ecp_CmpLT(s, _w_BPO) == 0;
+}
+
+static void edp_PolyPointMultiply(
+    Affine_POINT *r, const U_WORD *a, const U_WORD *b, const EDP_SIGV_CTX *ctx);
+static int edp_Verify_Check(
+    const EDP_SIGV_CTX *ctx, const unsigned char *signature,
+    const unsigned char *msg, size_t msg_size);
+
+/* Untraced bodies of the public entry points: the public APIs call these
+   rather than each other, so a trace records only the call the user made */
+static void *edp_Verify_InitEx(
+    void *context,
+    const unsigned char *publicKey,
+    int flags)
 {
     int i;
-    Ext_POINT Q, T;
+    Affine_POINT A;
+    Ext_POINT Q, R;
+#if !ECP_SMALL_FOOTPRINT
+    Ext_POINT T[4];
+    PE_POINT q1, q2;
+#endif
     EDP_SIGV_CTX *ctx = (EDP_SIGV_CTX*)context;
 
-    if (ctx == 0) ctx = (EDP_SIGV_CTX*)mem_alloc(sizeof(EDP_SIGV_CTX));
+    if (ctx == 0) ctx = (EDP_SIGV_CTX*)edp_Alloc(sizeof(EDP_SIGV_CTX));
 
     if (ctx)
     {
@@ -194,91 +311,298 @@ void * ed25519_Verify_Init(
         ecp_MulMod(Q.t, Q.x, Q.y);
         ecp_SetValue(Q.z, 1);
 
-        /* pre-compute q-table */
+#if ECP_SMALL_FOOTPRINT
+        /* pre-compute signed q-table: Q1 +/- Q0, Q1 = (2^128)*Q */
 
-        /* Calculate: Q0=Q, Q1=(2^64)*Q, Q2=(2^128)*Q, Q3=(2^192)*Q */
+        edp_ExtPoint2PE(&ctx->q, &Q);
 
-        ecp_SetValue(ctx->q_table[0].YpX, 1);           /* -- -- -- -- */
-        ecp_SetValue(ctx->q_table[0].YmX, 1);
-        ecp_SetValue(ctx->q_table[0].T2d, 0);
-        ecp_SetValue(ctx->q_table[0].Z2, 2);
+        for (i = 0; i < 128; i++) edp_DoublePoint(&Q);
 
-        edp_ExtPoint2PE(&ctx->q_table[1], &Q);          /* -- -- -- q0 */
+        edp_AddPoint(&R, &Q, &ctx->q);                  /* q1 +q0 */
+        edp_ExtPoint2PE(&ctx->q_table[1], &R);
+        edp_SubPoint(&R, &Q, &ctx->q);                  /* q1 -q0 */
+        edp_ExtPoint2PE(&ctx->q_table[0], &R);
+#else
+        /* pre-compute signed q-table: q_table[i] = Q3 + SUM(+/-Q_i) */
 
-        for (i = 0; i < 64; i++) edp_DoublePoint(&Q);
+        /* Calculate: Q0=Q, Q1=(2^64)*Q, Q2=(2^128)*Q, Q3=(2^192)*Q */
 
-        edp_ExtPoint2PE(&ctx->q_table[2], &Q);          /* -- -- q1 -- */
-        QTABLE_SET(3,1);                                /* -- -- q1 q0 */
+        edp_ExtPoint2PE(&ctx->q, &Q);
 
-        do edp_DoublePoint(&Q); while (++i < 128);
+        for (i = 0; i < 64; i++) edp_DoublePoint(&Q);
+        edp_ExtPoint2PE(&q1, &Q);
 
-        edp_ExtPoint2PE(&ctx->q_table[4], &Q);          /* -- q2 -- -- */
-        QTABLE_SET(5, 1);                               /* -- q2 -- q0 */
-        QTABLE_SET(6, 2);                               /* -- q2 q1 -- */
-        QTABLE_SET(7, 3);                               /* -- q2 q1 q0 */
+        do edp_DoublePoint(&Q); while (++i < 128);
+        edp_ExtPoint2PE(&q2, &Q);
 
         do edp_DoublePoint(&Q); while (++i < 192);
 
-        edp_ExtPoint2PE(&ctx->q_table[8], &Q);          /* q3 -- -- -- */
-        QTABLE_SET(9, 1);                               /* q3 -- -- q0 */
-        QTABLE_SET(10, 2);                              /* q3 -- q1 -- */
-        QTABLE_SET(11, 3);                              /* q3 -- q1 q0 */
-        QTABLE_SET(12, 4);                              /* q3 q2 -- -- */
-        QTABLE_SET(13, 5);                              /* q3 q2 -- q0 */
-        QTABLE_SET(14, 6);                              /* q3 q2 q1 -- */
-        QTABLE_SET(15, 7);                              /* q3 q2 q1 q0 */
+        edp_AddPoint(&T[2], &Q, &q2);                   /* q3 +q2 */
+        edp_SubPoint(&T[0], &Q, &q2);                   /* q3 -q2 */
+
+        edp_AddPoint(&T[3], &T[2], &q1);                /* q3 +q2 +q1 */
+        edp_SubPoint(&T[2], &T[2], &q1);                /* q3 +q2 -q1 */
+        edp_AddPoint(&T[1], &T[0], &q1);                /* q3 -q2 +q1 */
+        edp_SubPoint(&T[0], &T[0], &q1);                /* q3 -q2 -q1 */
+
+        for (i = 0; i < 4; i++)
+        {
+            edp_AddPoint(&R, &T[i], &ctx->q);           /* ... +q0 */
+            edp_ExtPoint2PE(&ctx->q_table[2*i+1], &R);
+            edp_SubPoint(&R, &T[i], &ctx->q);           /* ... -q0 */
+            edp_ExtPoint2PE(&ctx->q_table[2*i], &R);
+        }
+#endif
+        ctx->flags = flags & ed25519_verify_strict;
+        if (ctx->flags)
+        {
+            /* Paid once per key: canonical, not small-order and
+               torsion-free, i.e. BPO*(-Q) is the neutral point */
+            if (!edp_IsCanonicalPoint(publicKey) || edp_IsSmallOrder(publicKey))
+                ctx->flags |= EDP_KEY_REJECTED;
+            else
+            {
+                edp_PolyPointMultiply(&A, _w_Zero, _w_BPO, ctx);
+                if (ecp_CmpNE(A.x, _w_Zero) || ecp_CmpNE(A.y, _w_One))
+                    ctx->flags |= EDP_KEY_REJECTED;
+            }
+        }
     }
     return ctx;
 }
 
+int ed25519_VerifySignature(
+    const unsigned char *signature,             /* IN: signature (R,S) */
+    const unsigned char *publicKey,             /* IN: public key */
+    const unsigned char *msg, size_t msg_size)  /* IN: message to sign */
+{
+    EDP_SIGV_CTX ctx;
+    int rc;
+    EDP_TRACE_ENTRY(VerifySignature, publicKey, msg_size);
+
+    edp_Verify_InitEx(&ctx, publicKey, 0);
+
+    rc = edp_Verify_Check(&ctx, signature, msg, msg_size);
+    EDP_TRACE_EXIT(VerifySignature, publicKey, msg_size);
+    return rc;
+}
+
+void * ed25519_Verify_Init(
+    void *context,                      /* IO: null or context buffer to use */
+    const unsigned char *publicKey)     /* IN: [32 bytes] public key */
+{
+    void *ctx;
+    EDP_TRACE_ENTRY(Verify_Init, context, 0);
+
+    ctx = edp_Verify_InitEx(context, publicKey, 0);
+    EDP_TRACE_EXIT(Verify_Init, ctx, 0);
+    return ctx;
+}
+
+void * ed25519_Verify_InitEx(
+    void *context,                      /* IO: null or context buffer to use */
+    const unsigned char *publicKey,     /* IN: [32 bytes] public key */
+    int flags)                          /* IN: 0 or ed25519_verify_strict */
+{
+    void *ctx;
+    EDP_TRACE_ENTRY(Verify_InitEx, context, 0);
+
+    ctx = edp_Verify_InitEx(context, publicKey, flags);
+    EDP_TRACE_EXIT(Verify_InitEx, ctx, 0);
+    return ctx;
+}
+
 void ed25519_Verify_Finish(void *ctx)
 {
-    mem_free(ctx);
+    EDP_TRACE_ENTRY(Verify_Finish, ctx, 0);
+    edp_Free(ctx);
+    EDP_TRACE_EXIT(Verify_Finish, ctx, 0);
+}
+
+#if ECP_SMALL_FOOTPRINT
+/* Signed 2-fold slices of odd X (see ecp_8SignedFolds): with 
+   K = (X >> 1) | 2^255, Y[i] = (neg << 1) | index from bits 255-i, 127-i */
+static void edp_2SignedFolds(U8 *Y, const U_WORD *X)
+{
+    int i, j;
+    U8 x[32], k[32], s;
+
+    ecp_WordsToBytes(x, X);
+    for (i = 0; i < 31; i++) k[i] = (U8)((x[i] >> 1) | (x[i+1] << 7));
+    k[31] = (U8)((x[31] >> 1) | 0x80);
+
+    for (i = 0; i < 128; i++)
+    {
+        j = 127 - i;
+        s = (U8)((((k[16 + (j >> 3)] >> (j & 7)) & 1) << 1) | ((k[j >> 3] >> (j & 7)) & 1));
+        Y[i] = (U8)(s ^ 2 ^ (((s >> 1) - 1) & 1));
+    }
+}
+#define ecp_QSignedFolds    edp_2SignedFolds
+#else
+#define ecp_QSignedFolds    ecp_4SignedFolds
+#endif
+
+/* Low-latency split: S = a*P from the base slices u, on a helper thread */
+typedef struct
+{
+    Ext_POINT S;
+    const U8 *u;
+} EDP_BASE_JOB;
+
+static void edp_BaseJob(void *arg)
+{
+    EDP_BASE_JOB *job = (EDP_BASE_JOB*)arg;
+    const PA_POINT *p, *base = edp_BaseTable();
+    int i = 0;
+
+    /* top slice is always positive */
+    p = &base[job->u[0]];
+    ecp_SubReduce(job->S.x, p->YpX, p->YmX);    /* 2x */
+    ecp_AddReduce(job->S.y, p->YpX, p->YmX);    /* 2y */
+    ecp_MulReduce(job->S.t, p->T2d, _w_di);     /* 2xy */
+    ecp_SetValue(job->S.z, 2);                  /* 2z */
+
+    while (++i < ECP_BASE_SLICES)
+    {
+        edp_DoublePoint(&job->S);
+        if (job->u[i] & ECP_BASE_ENTRIES)
+            edp_SubAffinePoint(&job->S, &base[job->u[i] & (ECP_BASE_ENTRIES-1)]);
+        else
+            edp_AddAffinePoint(&job->S, &base[job->u[i]]);
+    }
 }
 
 /*
-    Assumptions: qtable = pre-computed Q
+    Assumptions: ctx = pre-computed Q
     Calculate: point R = a*P + b*Q  where P is base point
+    Slices are signed digits: bit ECP_BASE_ENTRIES (u) or EDP_Q_ENTRIES (v)
+    selects subtraction.
 */
 static void edp_PolyPointMultiply(
     Affine_POINT *r, 
     const U_WORD *a, 
     const U_WORD *b, 
-    const PE_POINT *qtable)
+    const EDP_SIGV_CTX *ctx)
 {
     int i = 1;
     Ext_POINT S;
-    const PE_POINT *q0;
-    U8 u[32], v[64];
-
-    ecp_8Folds(u, a);
-    ecp_4Folds(v, b);
-
-    /* Set initial value of S */
+    const PE_POINT *q0, *qtable = ctx->q_table;
+    const PA_POINT *base = edp_BaseTable();
+    U_WORD t[K_WORDS];
+    U8 u[ECP_BASE_SLICES], v[EDP_Q_SLICES], even_a, even_b;
+    EDP_BASE_JOB job;
+    PE_POINT p;
+    void *helper;
+    ECP_COUNT(EDP_OP_POLY_MULT);
+
+    /* Signed folding needs odd multipliers: use a+1 and b+1 if even */
+    ecp_Copy(t, a);
+    even_a = (U8)(~t[0] & 1);
+    t[0] |= 1;
+    ecp_BaseSignedFolds(u, t);
+
+    ecp_Copy(t, b);
+    even_b = (U8)(~t[0] & 1);
+    t[0] |= 1;
+    ecp_QSignedFolds(v, t);
+
+    /* Set initial value of S, top slice is always positive */
     q0 = &qtable[v[0]];
     ecp_SubReduce(S.x, q0->YpX, q0->YmX);   /* 2x */
     ecp_AddReduce(S.y, q0->YpX, q0->YmX);   /* 2y */
     ecp_MulReduce(S.t, q0->T2d, _w_di);     /* 2xy */
     ecp_Copy(S.z, q0->Z2);                  /* 2z */
 
-    do
-    {   /* 31D + 31A */
-        edp_DoublePoint(&S);
-        edp_AddPoint(&S, &S, &qtable[v[i]]);
-    } while (++i < 32);
+#define U_OFS   (EDP_Q_SLICES - ECP_BASE_SLICES)
 
-    do
-    {   /* 32D + 64A */
-        edp_DoublePoint(&S);
-        edp_AddAffinePoint(&S, &_w_base_folding8[u[i-32]]);
-        edp_AddPoint(&S, &S, &qtable[v[i]]);
-    } while (++i < 64);
+    job.u = u;
+    helper = edp_Helper_Post(edp_BaseJob, &job);
+    if (helper)
+    {
+        /* b*Q here, a*P on the helper, joined with one addition */
+        do
+        {
+            edp_DoublePoint(&S);
+            if (v[i] & EDP_Q_ENTRIES)
+                edp_SubPoint(&S, &S, &qtable[v[i] & (EDP_Q_ENTRIES-1)]);
+            else
+                edp_AddPoint(&S, &S, &qtable[v[i]]);
+        } while (++i < EDP_Q_SLICES);
+
+        edp_ExtPoint2PE(&p, &S);
+        edp_Helper_Join(helper);
+        edp_AddPoint(&S, &job.S, &p);
+    }
+    else
+    {
+        do
+        {   /* 31D + 31A (small: 63D + 63A) */
+            edp_DoublePoint(&S);
+            if (v[i] & EDP_Q_ENTRIES)
+                edp_SubPoint(&S, &S, &qtable[v[i] & (EDP_Q_ENTRIES-1)]);
+            else
+                edp_AddPoint(&S, &S, &qtable[v[i]]);
+        } while (++i < U_OFS);
+
+        do
+        {   /* 32D + 64A (small: 64D + 128A) */
+            edp_DoublePoint(&S);
+            if (u[i-U_OFS] & ECP_BASE_ENTRIES)
+                edp_SubAffinePoint(&S, &base[u[i-U_OFS] & (ECP_BASE_ENTRIES-1)]);
+            else
+                edp_AddAffinePoint(&S, &base[u[i-U_OFS]]);
+            if (v[i] & EDP_Q_ENTRIES)
+                edp_SubPoint(&S, &S, &qtable[v[i] & (EDP_Q_ENTRIES-1)]);
+            else
+                edp_AddPoint(&S, &S, &qtable[v[i]]);
+        } while (++i < EDP_Q_SLICES);
+    }
+
+    /* Remove the +1 of even multipliers */
+    if (even_a) edp_SubAffinePoint(&S, &_w_base_multiples[1]);
+    if (even_b) edp_SubPoint(&S, &S, &ctx->q);
 
     ecp_Inverse(S.z, S.z);
     ecp_MulMod(r->x, S.x, S.z);
     ecp_MulMod(r->y, S.y, S.z);
 }
 
+/* T = s*P + h*(-Q) = (s - h*a)*P = r*P = R, compare with enc(R) */
+static int ed25519_Verify_Digest(
+    const EDP_SIGV_CTX *ctx,
+    const unsigned char *signature,
+    const U8 *md)
+{
+    Affine_POINT T;
+    U_WORD h[K_WORDS], s[K_WORDS];
+    U8 enc[32];
+
+    if (edp_StrictReject(ctx, signature)) return 0;
+
+    eco_DigestToWords(h, md);
+    eco_Mod(h);
+
+    ecp_BytesToWords(s, signature+32);
+    edp_PolyPointMultiply(&T, s, h, ctx);
+    ed25519_PackPoint(enc, T.y, T.x[0]);
+
+    return (memcmp(enc, signature, 32) == 0) ? 1 : 0;
+}
+
+static int edp_Verify_Check(
+    const EDP_SIGV_CTX *ctx,
+    const unsigned char *signature,
+    const unsigned char *msg, size_t msg_size)
+{
+    U8 md[SHA512_DIGEST_LENGTH];
+
+    /* h = H(enc(R) + pk + m)  mod BPO */
+    SHA512_Hdr64(md, signature, ctx->pk, msg, msg_size);
+
+    return ed25519_Verify_Digest(ctx, signature, md);
+}
+
 /*
     This function can be used for batch verification.
     Assumptions: context = ed25519_Verify_Init(pk)
@@ -288,26 +612,215 @@ int ed25519_Verify_Check(
     const void  *context,                       /* IN: precomputes */
     const unsigned char *signature,             /* IN: signature (R,S) */
     const unsigned char *msg, size_t msg_size)  /* IN: message to sign */
+{
+    int rc;
+    EDP_TRACE_ENTRY(Verify_Check, context, msg_size);
+
+    rc = edp_Verify_Check((const EDP_SIGV_CTX*)context, signature, msg, msg_size);
+    EDP_TRACE_EXIT(Verify_Check, context, msg_size);
+    return rc;
+}
+
+/*
+    Verify a batch of signatures against the same public key.
+    H(enc(R) + pk + m) of up to SHA512_MB_LANES signatures are calculated
+    in parallel using multi-buffer SHA-512.
+    Assumptions: context = ed25519_Verify_Init(pk)
+*/
+int ed25519_Verify_CheckBatch(
+    const void  *context,                       /* IN: precomputes */
+    size_t count,                               /* IN: number of signatures */
+    const unsigned char * const *signatures,    /* IN: signatures (R,S) */
+    const unsigned char * const *msgs,          /* IN: messages */
+    const size_t *msg_sizes,                    /* IN: message sizes */
+    int *results)                               /* OUT: [optional] 1/0 per signature */
+{
+    const EDP_SIGV_CTX *ctx = (const EDP_SIGV_CTX*)context;
+    SHA512_MB_MGR mgr;
+    SHA512_MB_JOB jobs[SHA512_MB_LANES], *job, *idle[SHA512_MB_LANES];
+    size_t i, index[SHA512_MB_LANES];
+    int k, rc, all = 1, n_idle = SHA512_MB_LANES;
+    EDP_TRACE_ENTRY(Verify_CheckBatch, context, count);
+
+    SHA512_MB_Init(&mgr);
+    for (k = 0; k < SHA512_MB_LANES; k++) idle[k] = &jobs[k];
+
+    for (i = 0; ; )
+    {
+        if (i < count)
+        {
+            job = idle[--n_idle];
+            index[job - jobs] = i;
+            memcpy(job->prefix, signatures[i], 32);     /* enc(R) */
+            memcpy(job->prefix + 32, ctx->pk, 32);
+            job->prefix_len = 64;
+            job->data = msgs[i];
+            job->len = msg_sizes[i];
+            job = SHA512_MB_Submit(&mgr, job);
+            i++;
+        }
+        else if ((job = SHA512_MB_Flush(&mgr)) == 0)
+            break;
+
+        if (job)
+        {
+            k = (int)(job - jobs);
+            rc = ed25519_Verify_Digest(ctx, signatures[index[k]], job->md);
+            if (results) results[index[k]] = rc;
+            all &= rc;
+            idle[n_idle++] = job;
+        }
+    }
+    EDP_TRACE_EXIT(Verify_CheckBatch, context, count);
+    return all;
+}
+
+/* -- verify result cache --------------------------------------------------- */
+
+/*
+    Set-associative table of 32-byte keys, one bucket = 4 ways = 2 cache
+    lines. key = SHA-512(salt block + S + H(enc(R) + pk + m)); the second
+    digest already binds R, pk and m, so the message is hashed once. The
+    salt block is absorbed at init and its state copied per lookup, which
+    leaves one compression per key. Bucket locks are striped.
+*/
+#define EDP_VCACHE_WAYS     4
+#define EDP_VCACHE_KEY      32
+#define EDP_VCACHE_STRIPES  64
+
+typedef struct
+{
+    long lock;
+    U8 pad[64 - sizeof(long)];
+} EDP_VCACHE_LOCK;
+
+typedef struct
+{
+    EDP_VCACHE_LOCK locks[EDP_VCACHE_STRIPES];
+    SHA512_CTX salted;                  /* state after the salt block */
+    size_t mask;                        /* buckets - 1 */
+    U8 (*keys)[EDP_VCACHE_WAYS][EDP_VCACHE_KEY];
+} EDP_VCACHE;
+
+void *ed25519_VerifyCache_Init(
+    size_t entries,                     /* IN: capacity in signatures */
+    const unsigned char *salt,          /* IN: [salt_size bytes] secret random salt */
+    size_t salt_size)                   /* IN: size of salt */
+{
+    U8 block[128];
+    size_t buckets = 1;
+    EDP_VCACHE *cache;
+    EDP_TRACE_ENTRY(VerifyCache_Init, 0, entries);
+
+    cache = (EDP_VCACHE*)mem_alloc(sizeof(EDP_VCACHE));
+    if (cache == 0)
+    {
+        EDP_TRACE_EXIT(VerifyCache_Init, 0, entries);
+        return 0;
+    }
+    mem_clear(cache, sizeof(EDP_VCACHE));
+
+    while (buckets*EDP_VCACHE_WAYS < entries) buckets <<= 1;
+    cache->mask = buckets - 1;
+    cache->keys = (U8 (*)[EDP_VCACHE_WAYS][EDP_VCACHE_KEY])
+        mem_alloc(buckets*sizeof(cache->keys[0]));
+    if (cache->keys == 0)
+    {
+        mem_free(cache);
+        EDP_TRACE_EXIT(VerifyCache_Init, 0, entries);
+        return 0;
+    }
+    /* All-zero key marks an empty way */
+    mem_clear(cache->keys, buckets*sizeof(cache->keys[0]));
+
+    /* Salts longer than a block are hashed down */
+    mem_clear(block, sizeof(block));
+    SHA512_Init(&cache->salted);
+    if (salt_size > sizeof(block))
+    {
+        SHA512_Update(&cache->salted, salt, salt_size);
+        SHA512_Final(block, &cache->salted);
+        SHA512_Init(&cache->salted);
+    }
+    else if (salt_size)
+        memcpy(block, salt, salt_size);
+    SHA512_Update(&cache->salted, block, sizeof(block));
+    mem_clear(block, sizeof(block));
+
+    EDP_TRACE_EXIT(VerifyCache_Init, cache, entries);
+    return cache;
+}
+
+void ed25519_VerifyCache_Finish(void *cache)
+{
+    EDP_VCACHE *c = (EDP_VCACHE*)cache;
+    EDP_TRACE_ENTRY(VerifyCache_Finish, cache, 0);
+    if (c)
+    {
+        mem_free(c->keys);
+        mem_clear(c, sizeof(EDP_VCACHE));
+        mem_free(c);
+    }
+    EDP_TRACE_EXIT(VerifyCache_Finish, cache, 0);
+}
+
+static int edp_Verify_CheckCached(
+    const void  *context,
+    EDP_VCACHE *c,
+    const unsigned char *signature,
+    const unsigned char *msg, size_t msg_size)
 {
     SHA512_CTX H;
-    Affine_POINT T;
-    U_WORD h[K_WORDS], s[K_WORDS];
-    U8 md[SHA512_DIGEST_LENGTH];
+    U8 md[SHA512_DIGEST_LENGTH], key[SHA512_DIGEST_LENGTH];
+    U8 (*bucket)[EDP_VCACHE_KEY];
+    size_t b;
+    long *lock;
+    int i, rc = 0;
 
-    /* h = H(enc(R) + pk + m)  mod BPO */
-    SHA512_Init(&H);
-    SHA512_Update(&H, signature, 32);       /* enc(R) */
-    SHA512_Update(&H, ((EDP_SIGV_CTX*)context)->pk, 32);
-    SHA512_Update(&H, msg, msg_size);
-    SHA512_Final(md, &H);
-    eco_DigestToWords(h, md);
-    eco_Mod(h);
+    /* strict checks first: a hit may come from a non-strict context */
+    if (edp_StrictReject((const EDP_SIGV_CTX*)context, signature)) return 0;
 
-    /* T = s*P + h*(-Q) = (s - h*a)*P = r*P = R */
+    /* h = H(enc(R) + pk + m)  mod BPO */
+    SHA512_Hdr64(md, signature, ((EDP_SIGV_CTX*)context)->pk, msg, msg_size);
+    if (c == 0) return ed25519_Verify_Digest((const EDP_SIGV_CTX*)context, signature, md);
+
+    memcpy(&H, &c->salted, sizeof(H));
+    SHA512_Update(&H, signature+32, 32);
+    SHA512_Update(&H, md, sizeof(md));
+    SHA512_Final(key, &H);
+
+    /* key[0..31] is stored, key[32..] picks bucket and victim way */
+    b = ((size_t)key[32] | ((size_t)key[33] << 8) | 
+        ((size_t)key[34] << 16) | ((size_t)key[35] << 24)) & c->mask;
+    bucket = c->keys[b];
+    lock = &c->locks[b & (EDP_VCACHE_STRIPES-1)].lock;
+
+    EDP_LOCK(lock);
+    for (i = 0; i < EDP_VCACHE_WAYS; i++)
+        rc |= (memcmp(bucket[i], key, EDP_VCACHE_KEY) == 0);
+    EDP_UNLOCK(lock);
+    if (rc) return 1;
+
+    rc = ed25519_Verify_Digest((const EDP_SIGV_CTX*)context, signature, md);
+    if (rc)
+    {
+        EDP_LOCK(lock);
+        memcpy(bucket[key[40] & (EDP_VCACHE_WAYS-1)], key, EDP_VCACHE_KEY);
+        EDP_UNLOCK(lock);
+    }
+    return rc;
+}
 
-    ecp_BytesToWords(s, signature+32);
-    edp_PolyPointMultiply(&T, s, h, ((EDP_SIGV_CTX*)context)->q_table);
-    ed25519_PackPoint(md, T.y, T.x[0]);
+int ed25519_Verify_CheckCached(
+    const void  *context,                       /* IN: precomputes */
+    void *cache,                                /* IN: null or verify cache */
+    const unsigned char *signature,             /* IN: signature (R,S) */
+    const unsigned char *msg, size_t msg_size)  /* IN: message to sign */
+{
+    int rc;
+    EDP_TRACE_ENTRY(Verify_CheckCached, context, msg_size);
 
-    return (memcmp(md, signature, 32) == 0) ? 1 : 0;
+    rc = edp_Verify_CheckCached(context, (EDP_VCACHE*)cache, signature, msg, msg_size);
+    EDP_TRACE_EXIT(Verify_CheckCached, context, msg_size);
+    return rc;
 }
@@ -42,10 +42,48 @@
 #include <string.h>
 #include "../include/external_calls.h"
 #include "sha512.h"
+#include "curve25519_mehdi.h"
 
 #define UINT64(X)   X##ULL
 
-void SHA512_Transform (SHA512_CTX *ctx, const void *in);
+#ifdef ECP_SHA512_ASM
+static void sha512_block_select(SHA_LONG64 *h, const void *in, size_t num);
+static void (*sha512_block)(SHA_LONG64 *h, const void *in, size_t num) = sha512_block_select;
+
+/* Pick the transform on first use: AVX2 message schedule + BMI2 rounds
+   when available */
+static void sha512_block_select(SHA_LONG64 *h, const void *in, size_t num)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2"))
+        sha512_block = sha512_block_avx2;
+    else
+        sha512_block = sha512_block_x64;
+    sha512_block(h, in, num);
+}
+
+void SHA512_Transform (SHA512_CTX *c, const void *in)
+{
+    sha512_block(c->h, in, 1);
+}
+
+#define sha512_block_data_order(c,in,num) sha512_block((c)->h,in,num)
+#else
+void SHA512_Transform (SHA512_CTX *c, const void *in)
+{
+    SHA512_Transform_C(c, in);
+}
+
+static void sha512_block_data_order (SHA512_CTX *c, const void *in, size_t num)
+{
+    const unsigned char *data = (const unsigned char *)in;
+    while (num--)
+    {
+        SHA512_Transform_C(c, data);
+        data += SHA512_CBLOCK;
+    }
+}
+#endif
 
 void SHA512_Init (SHA512_CTX *c)
 {
@@ -64,6 +102,26 @@ void SHA512_Init (SHA512_CTX *c)
     c->md_len=SHA512_DIGEST_LENGTH;
 }
 
+/* Store state as big-endian digest */
+static void sha512_digest (unsigned char *md, const SHA_LONG64 *h)
+{
+    int i;
+    for (i = 0; i < SHA512_DIGEST_LENGTH/8; i++, md += 8)
+    {
+#if defined(ECP_CONFIG_BIG_ENDIAN)
+        memcpy (md, &h[i], 8);
+#elif defined(__GNUC__)
+        SHA_LONG64 t = __builtin_bswap64(h[i]);
+        memcpy (md, &t, 8);
+#else
+        M64 m;
+        m.u64 = h[i];
+        md[0] = m.u8.b7; md[1] = m.u8.b6; md[2] = m.u8.b5; md[3] = m.u8.b4;
+        md[4] = m.u8.b3; md[5] = m.u8.b2; md[6] = m.u8.b1; md[7] = m.u8.b0;
+#endif
+    }
+}
+
 void SHA512_Final (unsigned char *md, SHA512_CTX *c)
 {
     unsigned char *p=(unsigned char *)c->u.p;
@@ -100,19 +158,7 @@ void SHA512_Final (unsigned char *md, SHA512_CTX *c)
 
     SHA512_Transform (c,p);
 
-    if (md) for (n=0; n < SHA512_DIGEST_LENGTH/8; n++)
-    {
-        M64 m;
-        m.u64 = c->h[n];
-        *(md++) = m.u8.b7;
-        *(md++) = m.u8.b6;
-        *(md++) = m.u8.b5;
-        *(md++) = m.u8.b4;
-        *(md++) = m.u8.b3;
-        *(md++) = m.u8.b2;
-        *(md++) = m.u8.b1;
-        *(md++) = m.u8.b0;
-    }
+    if (md) sha512_digest (md, c->h);
 }
 
 void SHA512_Update (SHA512_CTX *c, const void *_data, size_t len)
@@ -145,18 +191,113 @@ void SHA512_Update (SHA512_CTX *c, const void *_data, size_t len)
         }
     }
 
-    while (len >= SHA512_CBLOCK)
+    /* Whole blocks are transformed straight from input */
+    if (len >= SHA512_CBLOCK)
     {
-        SHA512_Transform (c,data);//,len/SHA512_CBLOCK),
-        data += SHA512_CBLOCK;
-        len  -= SHA512_CBLOCK;
+        sha512_block_data_order (c,data,len/SHA512_CBLOCK);
+        data += len & ~(size_t)(SHA512_CBLOCK-1);
+        len  &= SHA512_CBLOCK-1;
     }
 
     if (len != 0)
         memcpy (p,data,len), c->num = (int)len;
 }
 
-static const SHA_LONG64 K512[80] = 
+/* -- Fixed-length fast paths ------------------------------------------------
+// Short messages are padded in place on the stack and compressed with one
+// or two block transforms, skipping the SHA512_CTX bookkeeping.
+// -------------------------------------------------------------------------- */
+
+/* Message of n < 2*SHA512_CBLOCK-16 bytes at the start of blk */
+static void sha512_short (unsigned char *md, unsigned char *blk, size_t n)
+{
+    SHA512_CTX c;
+    size_t nb = (n < SHA512_CBLOCK-16) ? 1 : 2;
+
+    blk[n] = 0x80;
+    mem_fill (blk+n+1, 0, nb*SHA512_CBLOCK-3-n);
+    blk[nb*SHA512_CBLOCK-2] = (unsigned char)(n >> 5);    /* size in bits */
+    blk[nb*SHA512_CBLOCK-1] = (unsigned char)(n << 3);
+
+    SHA512_Init (&c);
+    sha512_block_data_order (&c, blk, nb);
+    sha512_digest (md, c.h);
+    mem_clear (&c, sizeof(c));
+}
+
+/* Padding of a 32-byte message */
+static const unsigned char sha512_pad32[SHA512_CBLOCK-32] = {
+    0x80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x01,0x00 };
+
+/* md = H(in), in is 32 bytes */
+void SHA512_32 (unsigned char *md, const void *in)
+{
+    SHA512_CTX c;
+    unsigned char blk[SHA512_CBLOCK];
+
+    memcpy (blk, in, 32);
+    memcpy (blk + 32, sha512_pad32, sizeof(sha512_pad32));
+
+    SHA512_Init (&c);
+    sha512_block_data_order (&c, blk, 1);
+    sha512_digest (md, c.h);
+    mem_clear (&c, sizeof(c));
+    mem_clear (blk, sizeof(blk));
+}
+
+/* md = H(hdr + msg), hdr is 32 bytes */
+void SHA512_Hdr32 (unsigned char *md, const void *hdr, const void *msg, size_t len)
+{
+    SHA512_CTX c;
+    unsigned char blk[2*SHA512_CBLOCK];
+
+    if (len < 2*SHA512_CBLOCK-16-32)
+    {
+        memcpy (blk, hdr, 32);
+        memcpy (blk + 32, msg, len);
+        sha512_short (md, blk, 32 + len);
+        mem_clear (blk, 32);
+    }
+    else
+    {
+        SHA512_Init (&c);
+        SHA512_Update (&c, hdr, 32);
+        SHA512_Update (&c, msg, len);
+        SHA512_Final (md, &c);
+        mem_clear (&c, sizeof(c));
+    }
+}
+
+/* md = H(hdr1 + hdr2 + msg), hdr1 and hdr2 are 32 bytes each.
+   Headers may be secret (pool nonces): copies are wiped as in SHA512_Hdr32 */
+void SHA512_Hdr64 (unsigned char *md, const void *hdr1, const void *hdr2, 
+    const void *msg, size_t len)
+{
+    SHA512_CTX c;
+    unsigned char blk[2*SHA512_CBLOCK];
+
+    if (len < 2*SHA512_CBLOCK-16-64)
+    {
+        memcpy (blk, hdr1, 32);
+        memcpy (blk + 32, hdr2, 32);
+        memcpy (blk + 64, msg, len);
+        sha512_short (md, blk, 64 + len);
+        mem_clear (blk, 64);
+    }
+    else
+    {
+        SHA512_Init (&c);
+        SHA512_Update (&c, hdr1, 32);
+        SHA512_Update (&c, hdr2, 32);
+        SHA512_Update (&c, msg, len);
+        SHA512_Final (md, &c);
+        mem_clear (&c, sizeof(c));
+    }
+}
+
+const SHA_LONG64 sha512_K512[80] = 
 {
     UINT64(0x428a2f98d728ae22),UINT64(0x7137449123ef65cd),
     UINT64(0xb5c0fbcfec4d3b2f),UINT64(0xe9b5dba58189dbbc),
@@ -213,7 +354,7 @@ static const SHA_LONG64 K512[80] =
 #define Maj(x,y,z)  (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
 
 #define ROUND_00_15(i,a,b,c,d,e,f,g,h) do { \
-    T1 += h + Sigma1(e) + Ch(e,f,g) + K512[i]; \
+    T1 += h + Sigma1(e) + Ch(e,f,g) + sha512_K512[i]; \
     h = Sigma0(a) + Maj(a,b,c); \
     d += T1; h += T1; } while (0)
 
@@ -223,12 +364,14 @@ static const SHA_LONG64 K512[80] =
     T1 = X[(j)&0x0f] += s0 + s1 + X[(j+9)&0x0f]; \
     ROUND_00_15(i+j,a,b,c,d,e,f,g,h); } while (0)
 
-void SHA512_Transform (SHA512_CTX *ctx, const void *in)
+/* Portable transform, also the reference for assembly versions */
+void SHA512_Transform_C (SHA512_CTX *ctx, const void *in)
 {
     const SHA_LONG64 *W = (SHA_LONG64*)in;
     SHA_LONG64  a,b,c,d,e,f,g,h,s0,s1,T1;
     SHA_LONG64  X[16];
     int i;
+    ECP_COUNT(SHA_OP_BLOCK);
 
     a = ctx->h[0];  b = ctx->h[1];  c = ctx->h[2];  d = ctx->h[3];
     e = ctx->h[4];  f = ctx->h[5];  g = ctx->h[6];  h = ctx->h[7];
@@ -85,6 +85,57 @@ typedef struct SHA512state_st
 void SHA512_Init(SHA512_CTX *c);
 void SHA512_Update(SHA512_CTX *c, const void *data, size_t len);
 void SHA512_Final(unsigned char *md, SHA512_CTX *c);
+void SHA512_Transform(SHA512_CTX *c, const void *in);
+void SHA512_Transform_C(SHA512_CTX *c, const void *in);
+
+#ifdef ECP_SHA512_ASM
+/* x86-64 assembly transforms of num blocks, see asm64/amd64.gnu/Sha512.s.
+   sha512_block_avx2 needs AVX2 and BMI2. */
+void sha512_block_x64(SHA_LONG64 *h, const void *in, size_t num);
+void sha512_block_avx2(SHA_LONG64 *h, const void *in, size_t num);
+#endif
+
+/* One-shot hashes with fixed-size headers; one or two block transforms
+   when the whole message fits (hdr + msg < 240 bytes). Headers may be
+   secret: their stack copies are wiped */
+void SHA512_32(unsigned char *md, const void *in);
+void SHA512_Hdr32(unsigned char *md, const void *hdr, const void *msg, size_t len);
+void SHA512_Hdr64(unsigned char *md, const void *hdr1, const void *hdr2, 
+    const void *msg, size_t len);
+
+extern const SHA_LONG64 sha512_K512[80];
+
+/* Multi-buffer SHA-512: hashes up to SHA512_MB_LANES independent messages
+ * in parallel (AVX2 when the CPU supports it).
+ * Each job hashes prefix || data. Jobs are handed over with SHA512_MB_Submit
+ * and come back, in completion order, from SHA512_MB_Submit or
+ * SHA512_MB_Flush. A submitted job must stay untouched until it comes back.
+ */
+#define SHA512_MB_LANES         4
+#define SHA512_MB_MAX_PREFIX    64
+
+typedef struct
+{
+    unsigned char prefix[SHA512_MB_MAX_PREFIX]; /* IN: hashed before data */
+    unsigned int prefix_len;                    /* IN: <= SHA512_MB_MAX_PREFIX */
+    const unsigned char *data;                  /* IN: message */
+    size_t len;                                 /* IN: size of message */
+    unsigned char md[SHA512_DIGEST_LENGTH];     /* OUT: digest */
+} SHA512_MB_JOB;
+
+typedef struct
+{
+    SHA_LONG64 h[8][SHA512_MB_LANES];   /* lane states, word interleaved */
+    SHA512_MB_JOB *job[SHA512_MB_LANES];
+    size_t block[SHA512_MB_LANES];      /* next block to compress */
+    size_t blocks[SHA512_MB_LANES];     /* padded message size in blocks */
+    unsigned char buf[SHA512_MB_LANES][SHA512_CBLOCK];
+    int avx2;
+} SHA512_MB_MGR;
+
+void SHA512_MB_Init(SHA512_MB_MGR *mgr);
+SHA512_MB_JOB *SHA512_MB_Submit(SHA512_MB_MGR *mgr, SHA512_MB_JOB *job);
+SHA512_MB_JOB *SHA512_MB_Flush(SHA512_MB_MGR *mgr);
 
 #ifdef  __cplusplus
 }
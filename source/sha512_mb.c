@@ -0,0 +1,295 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "../include/external_calls.h"
+#include "sha512.h"
+#include "curve25519_mehdi.h"
+
+/*
+ * Multi-buffer SHA-512.
+ * Four independent messages are compressed side by side, one 64-bit lane
+ * of a 256-bit AVX2 register per message. Each lane walks its own padded
+ * block stream: blocks that lie entirely inside the caller's data are read
+ * in place, prefix/tail blocks are assembled in the lane buffer.
+ * CPUs without AVX2 fall back to SHA512_Transform() on each lane.
+ */
+
+#if !defined(ECP_NO_AVX2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA512_MB_AVX2
+#include <immintrin.h>
+#endif
+
+static const unsigned char sha512_mb_idle[SHA512_CBLOCK] = { 0 };
+
+#ifdef SHA512_MB_AVX2
+
+#define MB_ADD(x,y)     _mm256_add_epi64(x,y)
+#define MB_XOR(x,y)     _mm256_xor_si256(x,y)
+#define MB_ROTR(x,s)    _mm256_or_si256(_mm256_srli_epi64(x,s), _mm256_slli_epi64(x,64-(s)))
+
+#define MB_Sigma0(x)    MB_XOR(MB_XOR(MB_ROTR(x,28), MB_ROTR(x,34)), MB_ROTR(x,39))
+#define MB_Sigma1(x)    MB_XOR(MB_XOR(MB_ROTR(x,14), MB_ROTR(x,18)), MB_ROTR(x,41))
+#define MB_sigma0(x)    MB_XOR(MB_XOR(MB_ROTR(x,1), MB_ROTR(x,8)), _mm256_srli_epi64(x,7))
+#define MB_sigma1(x)    MB_XOR(MB_XOR(MB_ROTR(x,19), MB_ROTR(x,61)), _mm256_srli_epi64(x,6))
+
+/* Ch(x,y,z) = (x & y) ^ (~x & z), Maj(x,y,z) = ((x ^ y) & z) ^ (x & y) */
+#define MB_Ch(x,y,z)    MB_XOR(_mm256_and_si256(x,y), _mm256_andnot_si256(x,z))
+#define MB_Maj(x,y,z)   MB_XOR(_mm256_and_si256(MB_XOR(x,y),z), _mm256_and_si256(x,y))
+
+__attribute__((target("avx2")))
+static void sha512_x4_avx2(SHA_LONG64 st[8][SHA512_MB_LANES], const unsigned char *in[SHA512_MB_LANES])
+{
+    __m256i a, b, c, d, e, f, g, h, T1, T2, r0, r1, r2, r3;
+    __m256i W[16];
+    const __m256i bswap = _mm256_set_epi8(
+        8,9,10,11,12,13,14,15, 0,1,2,3,4,5,6,7,
+        8,9,10,11,12,13,14,15, 0,1,2,3,4,5,6,7);
+    int i;
+    ECP_COUNT(SHA_OP_BLOCK_X4);
+
+    /* Transpose 4x4 word blocks: W[i] = { lane0.w[i], ..., lane3.w[i] } */
+    for (i = 0; i < 16; i += 4)
+    {
+        r0 = _mm256_loadu_si256((const __m256i*)(in[0] + 8*i));
+        r1 = _mm256_loadu_si256((const __m256i*)(in[1] + 8*i));
+        r2 = _mm256_loadu_si256((const __m256i*)(in[2] + 8*i));
+        r3 = _mm256_loadu_si256((const __m256i*)(in[3] + 8*i));
+        T1 = _mm256_unpacklo_epi64(r0, r1);
+        T2 = _mm256_unpackhi_epi64(r0, r1);
+        r0 = _mm256_unpacklo_epi64(r2, r3);
+        r1 = _mm256_unpackhi_epi64(r2, r3);
+        W[i+0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(T1, r0, 0x20), bswap);
+        W[i+1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(T2, r1, 0x20), bswap);
+        W[i+2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(T1, r0, 0x31), bswap);
+        W[i+3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(T2, r1, 0x31), bswap);
+    }
+
+    a = _mm256_loadu_si256((const __m256i*)st[0]);
+    b = _mm256_loadu_si256((const __m256i*)st[1]);
+    c = _mm256_loadu_si256((const __m256i*)st[2]);
+    d = _mm256_loadu_si256((const __m256i*)st[3]);
+    e = _mm256_loadu_si256((const __m256i*)st[4]);
+    f = _mm256_loadu_si256((const __m256i*)st[5]);
+    g = _mm256_loadu_si256((const __m256i*)st[6]);
+    h = _mm256_loadu_si256((const __m256i*)st[7]);
+
+    for (i = 0; i < 80; i++)
+    {
+        if (i >= 16)
+        {
+            T1 = MB_ADD(MB_sigma0(W[(i+1)&15]), MB_sigma1(W[(i+14)&15]));
+            W[i&15] = MB_ADD(W[i&15], MB_ADD(T1, W[(i+9)&15]));
+        }
+        T1 = MB_ADD(MB_ADD(h, MB_Sigma1(e)), MB_Ch(e,f,g));
+        T1 = MB_ADD(T1, MB_ADD(W[i&15], _mm256_set1_epi64x((long long)sha512_K512[i])));
+        T2 = MB_ADD(MB_Sigma0(a), MB_Maj(a,b,c));
+        h = g; g = f; f = e; e = MB_ADD(d, T1);
+        d = c; c = b; b = a; a = MB_ADD(T1, T2);
+    }
+
+    _mm256_storeu_si256((__m256i*)st[0], MB_ADD(a, _mm256_loadu_si256((const __m256i*)st[0])));
+    _mm256_storeu_si256((__m256i*)st[1], MB_ADD(b, _mm256_loadu_si256((const __m256i*)st[1])));
+    _mm256_storeu_si256((__m256i*)st[2], MB_ADD(c, _mm256_loadu_si256((const __m256i*)st[2])));
+    _mm256_storeu_si256((__m256i*)st[3], MB_ADD(d, _mm256_loadu_si256((const __m256i*)st[3])));
+    _mm256_storeu_si256((__m256i*)st[4], MB_ADD(e, _mm256_loadu_si256((const __m256i*)st[4])));
+    _mm256_storeu_si256((__m256i*)st[5], MB_ADD(f, _mm256_loadu_si256((const __m256i*)st[5])));
+    _mm256_storeu_si256((__m256i*)st[6], MB_ADD(g, _mm256_loadu_si256((const __m256i*)st[6])));
+    _mm256_storeu_si256((__m256i*)st[7], MB_ADD(h, _mm256_loadu_si256((const __m256i*)st[7])));
+}
+#endif /* SHA512_MB_AVX2 */
+
+static void sha512_x4_scalar(SHA512_MB_MGR *mgr, const unsigned char *in[SHA512_MB_LANES])
+{
+    int i, j;
+    SHA512_CTX c;
+
+    for (j = 0; j < SHA512_MB_LANES; j++)
+    {
+        if (mgr->job[j] == 0) continue;
+        for (i = 0; i < 8; i++) c.h[i] = mgr->h[i][j];
+        SHA512_Transform(&c, in[j]);
+        for (i = 0; i < 8; i++) mgr->h[i][j] = c.h[i];
+    }
+}
+
+/* Return next block of the padded message in lane j */
+static const unsigned char *sha512_mb_block(SHA512_MB_MGR *mgr, int j)
+{
+    const SHA512_MB_JOB *job = mgr->job[j];
+    unsigned char *p = mgr->buf[j];
+    size_t start = mgr->block[j]*SHA512_CBLOCK;
+    size_t total = job->prefix_len + job->len;
+    size_t n = 0, k;
+
+    if (start >= job->prefix_len && start + SHA512_CBLOCK <= total)
+        return job->data + (start - job->prefix_len);
+
+    if (start < job->prefix_len)
+    {
+        n = job->prefix_len - start;
+        memcpy(p, job->prefix + start, n);
+    }
+    if (start + n < total)
+    {
+        k = total - start;
+        if (k > SHA512_CBLOCK) k = SHA512_CBLOCK;
+        memcpy(p + n, job->data + (start + n - job->prefix_len), k - n);
+        n = k;
+    }
+    if (n < SHA512_CBLOCK)
+    {
+        if (start <= total) p[n++] = 0x80;
+        mem_fill(p + n, 0, SHA512_CBLOCK - n);
+    }
+    if (mgr->block[j] + 1 == mgr->blocks[j])
+    {
+        /* message size in bits, 128-bit big-endian */
+        SHA_LONG64 nl = ((SHA_LONG64)total) << 3;
+        SHA_LONG64 nh = (sizeof(total) >= 8) ? ((SHA_LONG64)total) >> 61 : 0;
+        for (k = 0; k < 8; k++)
+        {
+            p[SHA512_CBLOCK-1-k] = (unsigned char)(nl >> (8*k));
+            p[SHA512_CBLOCK-9-k] = (unsigned char)(nh >> (8*k));
+        }
+    }
+    return p;
+}
+
+static void sha512_mb_digest(SHA512_MB_MGR *mgr, int j)
+{
+    int i;
+    unsigned char *md = mgr->job[j]->md;
+
+    for (i = 0; i < 8; i++)
+    {
+        SHA_LONG64 v = mgr->h[i][j];
+        md[0] = (unsigned char)(v >> 56);
+        md[1] = (unsigned char)(v >> 48);
+        md[2] = (unsigned char)(v >> 40);
+        md[3] = (unsigned char)(v >> 32);
+        md[4] = (unsigned char)(v >> 24);
+        md[5] = (unsigned char)(v >> 16);
+        md[6] = (unsigned char)(v >> 8);
+        md[7] = (unsigned char)(v);
+        md += 8;
+    }
+}
+
+/* Return lane of a finished job, or -1 */
+static int sha512_mb_done(SHA512_MB_MGR *mgr)
+{
+    int j;
+    for (j = 0; j < SHA512_MB_LANES; j++)
+        if (mgr->job[j] && mgr->block[j] == mgr->blocks[j]) return j;
+    return -1;
+}
+
+/* Compress all busy lanes until at least one of them finishes */
+static void sha512_mb_run(SHA512_MB_MGR *mgr)
+{
+    const unsigned char *in[SHA512_MB_LANES];
+    size_t n = (size_t)(-1);
+    int j;
+
+    for (j = 0; j < SHA512_MB_LANES; j++)
+        if (mgr->job[j] && mgr->blocks[j] - mgr->block[j] < n)
+            n = mgr->blocks[j] - mgr->block[j];
+
+    while (n-- > 0)
+    {
+        for (j = 0; j < SHA512_MB_LANES; j++)
+            in[j] = mgr->job[j] ? sha512_mb_block(mgr, j) : sha512_mb_idle;
+#ifdef SHA512_MB_AVX2
+        if (mgr->avx2)
+            sha512_x4_avx2(mgr->h, in);
+        else
+#endif
+            sha512_x4_scalar(mgr, in);
+
+        for (j = 0; j < SHA512_MB_LANES; j++)
+        {
+            if (mgr->job[j] && ++mgr->block[j] == mgr->blocks[j])
+                sha512_mb_digest(mgr, j);
+        }
+    }
+}
+
+static SHA512_MB_JOB *sha512_mb_release(SHA512_MB_MGR *mgr, int j)
+{
+    SHA512_MB_JOB *job = mgr->job[j];
+    mgr->job[j] = 0;
+    return job;
+}
+
+void SHA512_MB_Init(SHA512_MB_MGR *mgr)
+{
+    mem_clear(mgr, sizeof(SHA512_MB_MGR));
+#ifdef SHA512_MB_AVX2
+    __builtin_cpu_init();
+    mgr->avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+#endif
+}
+
+/* Queue a job. Returns a finished job once all lanes are busy, or null */
+SHA512_MB_JOB *SHA512_MB_Submit(SHA512_MB_MGR *mgr, SHA512_MB_JOB *job)
+{
+    int i, j;
+    SHA512_CTX c;
+
+    for (j = 0; mgr->job[j] != 0; j++) ;
+
+    SHA512_Init(&c);
+    for (i = 0; i < 8; i++) mgr->h[i][j] = c.h[i];
+    mgr->job[j] = job;
+    mgr->block[j] = 0;
+    mgr->blocks[j] = (job->prefix_len + job->len + 16 + SHA512_CBLOCK) / SHA512_CBLOCK;
+
+    for (i = 0; i < SHA512_MB_LANES; i++)
+        if (mgr->job[i] == 0) return 0;
+
+    if ((j = sha512_mb_done(mgr)) < 0)
+    {
+        sha512_mb_run(mgr);
+        j = sha512_mb_done(mgr);
+    }
+    return sha512_mb_release(mgr, j);
+}
+
+/* Finish pending jobs. Returns one finished job per call, null when idle */
+SHA512_MB_JOB *SHA512_MB_Flush(SHA512_MB_MGR *mgr)
+{
+    int j;
+
+    for (j = 0; j < SHA512_MB_LANES; j++)
+        if (mgr->job[j]) break;
+    if (j == SHA512_MB_LANES) return 0;
+
+    if ((j = sha512_mb_done(mgr)) < 0)
+    {
+        sha512_mb_run(mgr);
+        j = sha512_mb_done(mgr);
+    }
+    return sha512_mb_release(mgr, j);
+}
@@ -0,0 +1,929 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2015 mehdi sotoodeh
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the 
+ * "Software"), to deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, merge, publish, 
+ * distribute, sublicense, and/or sell copies of the Software, and to 
+ * permit persons to whom the Software is furnished to do so, subject to 
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included 
+ * in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*  Micro-benchmarks for the library internals and public API.
+
+    curve25519_bench [-f text|csv|json] [-n samples] [-p] [filter]
+    curve25519_bench -s [-T threads] [-d msec] [-f text|csv|json] [filter]
+
+    Each sample times a run of calls sized to roughly BENCH_TARGET cycles
+    and records the cost per call. Median, p90 and p99 are reported in
+    cycles (time stamp counter) and nanoseconds, plus calls/sec from the
+    median. Batch entries ("xN") report the cost of the whole batch.
+    -p adds IPC and L1D read misses per call from perf_event_open (Linux);
+    columns stay empty when the counters are not available.
+    filter selects entries whose group or name contains the string.
+
+    -s measures throughput of sign, verify and DH on pinned threads
+    (see scale_Main) for shared and distinct keys, hot and cold verify
+    contexts and short and long messages.
+*/
+#if defined(__linux__)
+#define _GNU_SOURCE                 /* pthread_setaffinity_np */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/external_calls.h"
+#include "../source/curve25519_mehdi.h"
+#include "../include/curve25519_dh.h"
+#include "../include/ed25519_signature.h"
+#include "../source/sha512.h"
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <time.h>
+#endif
+
+#if ECP_THREADS && (defined(__unix__) || defined(__APPLE__))
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#define BENCH_THREADS   1
+#else
+#define BENCH_THREADS   0
+#endif
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define BENCH_PERF  1
+#else
+#define BENCH_PERF  0
+#endif
+
+#define BENCH_TARGET    10000       /* cycles per sample */
+#define BENCH_MAX_REPS  1024        /* calls per sample */
+#define BENCH_SAMPLES   200
+#define BENCH_BATCH     16
+#define BENCH_MSG_SIZE  64
+
+/* -- timers ---------------------------------------------------------------- */
+
+static U64 bench_cycles(void)
+{
+#if defined(_MSC_VER)
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    U32 lo, hi;
+    __asm__ volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((U64)hi << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+static U64 bench_ns(void)
+{
+#if defined(_MSC_VER)
+    LARGE_INTEGER c, f;
+    QueryPerformanceCounter(&c);
+    QueryPerformanceFrequency(&f);
+    return (U64)((double)c.QuadPart * 1e9 / (double)f.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (U64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* -- hardware counters ----------------------------------------------------- */
+
+#define PERF_CYCLES     0
+#define PERF_INSTR      1
+#define PERF_L1D_MISS   2
+#define PERF_EVENTS     3
+
+typedef struct {
+    int fd[PERF_EVENTS];
+    int enabled;
+} BENCH_PERF_CTX;
+
+#if BENCH_PERF
+static int perf_Open(int group, U32 type, U64 config)
+{
+    struct perf_event_attr pe;
+    memset(&pe, 0, sizeof(pe));
+    pe.size = sizeof(pe);
+    pe.type = type;
+    pe.config = config;
+    pe.disabled = (group < 0);
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+    pe.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(__NR_perf_event_open, &pe, 0, -1, group, 0);
+}
+#endif
+
+/* Opens the counters when requested, returns 1 when they are available */
+static int perf_Init(BENCH_PERF_CTX *pc, int want)
+{
+    int i;
+    for (i = 0; i < PERF_EVENTS; i++) pc->fd[i] = -1;
+    pc->enabled = 0;
+#if BENCH_PERF
+    if (!want) return 0;
+    pc->fd[PERF_CYCLES] = perf_Open(-1, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    if (pc->fd[PERF_CYCLES] < 0) return 0;
+    pc->fd[PERF_INSTR] = perf_Open(pc->fd[PERF_CYCLES], 
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    pc->fd[PERF_L1D_MISS] = perf_Open(pc->fd[PERF_CYCLES], PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    if (pc->fd[PERF_INSTR] < 0)
+    {
+        close(pc->fd[PERF_CYCLES]);
+        if (pc->fd[PERF_L1D_MISS] >= 0) close(pc->fd[PERF_L1D_MISS]);
+        return 0;
+    }
+    pc->enabled = 1;
+#endif
+    return pc->enabled;
+}
+
+static void perf_Start(BENCH_PERF_CTX *pc)
+{
+#if BENCH_PERF
+    if (!pc->enabled) return;
+    ioctl(pc->fd[PERF_CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(pc->fd[PERF_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+/* Stops counting, returns values in counted order (cycles, instr[, misses]) */
+static int perf_Stop(BENCH_PERF_CTX *pc, U64 *val)
+{
+#if BENCH_PERF
+    U64 buf[1 + PERF_EVENTS];
+    ssize_t n;
+    int i;
+    if (!pc->enabled) return 0;
+    ioctl(pc->fd[PERF_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    n = read(pc->fd[PERF_CYCLES], buf, sizeof(buf));
+    if (n < (ssize_t)(3*sizeof(U64))) return 0;
+    for (i = 0; i < (int)buf[0] && i < PERF_EVENTS; i++) val[i] = buf[1 + i];
+    return (int)buf[0];
+#else
+    return 0;
+#endif
+}
+
+static void perf_Finish(BENCH_PERF_CTX *pc)
+{
+#if BENCH_PERF
+    int i;
+    for (i = 0; i < PERF_EVENTS; i++)
+        if (pc->fd[i] >= 0) close(pc->fd[i]);
+#endif
+    pc->enabled = 0;
+}
+
+/* -- benchmark state ------------------------------------------------------- */
+
+static U8 bn_msg[BENCH_BATCH][BENCH_MSG_SIZE];
+static U8 bn_sig[BENCH_BATCH][64];
+static U8 bn_out[BENCH_BATCH*64];
+static U8 bn_data[8192];
+static U8 bn_sk[32], bn_pk[32], bn_priv[64], bn_tweaks[BENCH_BATCH*32];
+static U8 bn_dh_sk[32], bn_dh_pk[32], bn_folds[64];
+static U8 bn_digest[SHA512_DIGEST_LENGTH];
+static U_WORD bn_a[K_WORDS], bn_b[K_WORDS], bn_c[K_WORDS], bn_w[2*K_WORDS];
+static U_WORD bn_odd[K_WORDS];
+static Ext_POINT bn_P;
+static PE_POINT bn_Q;
+static PA_POINT bn_PA;
+static Affine_POINT bn_aff;
+static const U8 *bn_msgs[BENCH_BATCH];
+static U8 *bn_sigs[BENCH_BATCH];
+static U8 *bn_outs[BENCH_BATCH];
+static size_t bn_sizes[BENCH_BATCH];
+static int bn_results[BENCH_BATCH];
+static size_t bn_data_size;
+static SHA512_MB_MGR bn_mgr;
+static SHA512_MB_JOB bn_jobs[SHA512_MB_LANES];
+static void *bn_blinding, *bn_sign_ctx, *bn_sign_tmp, *bn_pool;
+static void *bn_seq, *bn_ver_ctx, *bn_ver_strict, *bn_ver_tmp, *bn_cache;
+
+static const unsigned char bn_seed[32] =
+{
+    0xea,0x30,0xb1,0x6d,0x83,0x9e,0xa3,0x1a,0x86,0x34,0x01,0x9d,0x4a,0xf3,0x36,0x93,
+    0x6d,0x54,0x2b,0xa1,0x63,0x03,0x93,0x85,0xcc,0x03,0x0a,0x7d,0xe1,0xae,0xa7,0xbb
+};
+
+static void bench_Setup(void)
+{
+    int i;
+    Ext_POINT I;
+
+    for (i = 0; i < (int)sizeof(bn_data); i++) bn_data[i] = (U8)(i*7 + 3);
+    for (i = 0; i < 32; i++) bn_sk[i] = bn_dh_sk[i] = (U8)(bn_seed[i] ^ 0x5a);
+    for (i = 0; i < BENCH_BATCH*32; i++) bn_tweaks[i] = (U8)(i*13 + 1);
+    for (i = 0; i < K_WORDS; i++)
+    {
+        bn_a[i] = (U_WORD)(0x9e3779b97f4a7c15ULL * (i + 1));
+        bn_b[i] = (U_WORD)(0xc2b2ae3d27d4eb4fULL * (i + 3));
+    }
+    bn_a[K_WORDS-1] &= (U_WORD)(-1) >> 4;
+    bn_b[K_WORDS-1] &= (U_WORD)(-1) >> 4;
+    ecp_Copy(bn_c, bn_a);
+    ecp_Copy(bn_odd, bn_a);
+    bn_odd[0] |= 1;
+    for (i = 0; i < 2*K_WORDS; i++) bn_w[i] = (U_WORD)(0x94d049bb133111ebULL * (i + 5));
+
+    /* B and 2B */
+    memset(&I, 0, sizeof(I));
+    ecp_SetValue(I.y, 1);
+    ecp_SetValue(I.z, 1);
+    edp_AddBasePoint(&I);
+    bn_P = I;
+    edp_DoublePoint(&bn_P);
+    edp_ExtPoint2PE(&bn_Q, &I);
+    edp_ScanSlice(&bn_PA, edp_BaseTable(), 1);
+
+    for (i = 0; i < BENCH_BATCH; i++)
+    {
+        memcpy(bn_msg[i], bn_data + i, BENCH_MSG_SIZE);
+        bn_msgs[i] = bn_msg[i];
+        bn_sigs[i] = bn_sig[i];
+        bn_outs[i] = bn_out + 64*i;
+        bn_sizes[i] = BENCH_MSG_SIZE;
+    }
+    for (i = 0; i < SHA512_MB_LANES; i++)
+    {
+        bn_jobs[i].prefix_len = 0;
+        bn_jobs[i].data = bn_data;
+        bn_jobs[i].len = 1024;
+    }
+
+    bn_blinding = ed25519_Blinding_Init(0, bn_seed, sizeof(bn_seed));
+    ed25519_CreateKeyPair(bn_pk, bn_priv, 0, bn_sk);
+    bn_sign_ctx = ed25519_Sign_Init(0, bn_priv, bn_blinding);
+    bn_sign_tmp = ed25519_Sign_Init(0, bn_priv, 0);
+    bn_pool = ed25519_SignPool_Init(bn_sign_ctx, BENCH_MAX_REPS, bn_seed, sizeof(bn_seed));
+    bn_seq = ed25519_KeySeq_Init(0, bn_pk);
+    ed25519_SignBatch(bn_sign_ctx, bn_sigs, bn_msgs, bn_sizes, BENCH_BATCH);
+    bn_ver_ctx = ed25519_Verify_Init(0, bn_pk);
+    bn_ver_strict = ed25519_Verify_InitEx(0, bn_pk, ed25519_verify_strict);
+    bn_ver_tmp = ed25519_Verify_Init(0, bn_pk);
+    bn_cache = ed25519_VerifyCache_Init(64, bn_seed, sizeof(bn_seed));
+    curve25519_dh_CalculatePublicKey(bn_dh_pk, bn_dh_sk);
+
+    /* Verify benchmarks time the success path */
+    if (!ed25519_Verify_CheckBatch(bn_ver_ctx, BENCH_BATCH, 
+            (const U8 * const *)bn_sigs, bn_msgs, bn_sizes, 0) ||
+        !ed25519_Verify_CheckCached(bn_ver_strict, bn_cache, bn_sig[0], 
+            bn_msg[0], BENCH_MSG_SIZE))
+    {
+        fprintf(stderr, "benchmark setup: signature check failed\n");
+        exit(1);
+    }
+}
+
+static void bench_Cleanup(void)
+{
+    ed25519_VerifyCache_Finish(bn_cache);
+    ed25519_Verify_Finish(bn_ver_tmp);
+    ed25519_Verify_Finish(bn_ver_strict);
+    ed25519_Verify_Finish(bn_ver_ctx);
+    ed25519_KeySeq_Finish(bn_seq);
+    ed25519_SignPool_Finish(bn_pool);
+    ed25519_Sign_Finish(bn_sign_tmp);
+    ed25519_Sign_Finish(bn_sign_ctx);
+    ed25519_Blinding_Finish(bn_blinding);
+}
+
+/* -- field, folds, points, scalars ----------------------------------------- */
+
+static void b_ecp_AddReduce(void) { ecp_AddReduce(bn_c, bn_c, bn_b); }
+static void b_ecp_SubReduce(void) { ecp_SubReduce(bn_c, bn_c, bn_b); }
+static void b_ecp_MulReduce(void) { ecp_MulReduce(bn_c, bn_c, bn_b); }
+static void b_ecp_SqrReduce(void) { ecp_SqrReduce(bn_c, bn_c); }
+static void b_ecp_Inverse(void) { ecp_Inverse(bn_c, bn_a); }
+static void b_ecp_ModExp2523(void) { ecp_ModExp2523(bn_c, bn_a); }
+static void b_ecp_4SignedFolds(void) { ecp_4SignedFolds(bn_folds, bn_odd); }
+static void b_ecp_8SignedFolds(void) { ecp_8SignedFolds(bn_folds, bn_odd); }
+static void b_edp_DoublePoint(void) { edp_DoublePoint(&bn_P); }
+static void b_edp_AddPoint(void) { edp_AddPoint(&bn_P, &bn_P, &bn_Q); }
+static void b_edp_AddAffinePoint(void) { edp_AddAffinePoint(&bn_P, &bn_PA); }
+static void b_edp_AddBasePoint(void) { edp_AddBasePoint(&bn_P); }
+static void b_edp_ExtPoint2PE(void) { edp_ExtPoint2PE(&bn_Q, &bn_P); }
+static void b_edp_ScanSlice(void) { edp_ScanSlice(&bn_PA, edp_BaseTable(), 5); }
+static void b_edp_BasePointMultiply(void) { edp_BasePointMultiply(&bn_aff, bn_a, 0); }
+static void b_eco_AddReduce(void) { eco_AddReduce(bn_c, bn_c, bn_b); }
+static void b_eco_MulReduce(void) { eco_MulReduce(bn_c, bn_c, bn_b); }
+static void b_eco_MulAddReduce(void) { eco_MulAddReduce(bn_c, bn_c, bn_b, bn_a); }
+static void b_eco_MontMul(void) { eco_MontMul(bn_c, bn_c, bn_b); }
+static void b_eco_Reduce512(void) { eco_Reduce512(bn_c, bn_w); }
+static void b_eco_DigestToWords(void) { eco_DigestToWords(bn_c, bn_data); }
+static void b_eco_InvModBPO(void) { eco_InvModBPO(bn_c, bn_a); }
+
+/* -- SHA-512 ---------------------------------------------------------------- */
+
+static void b_sha512(void)
+{
+    SHA512_CTX ctx;
+    SHA512_Init(&ctx);
+    SHA512_Update(&ctx, bn_data, bn_data_size);
+    SHA512_Final(bn_digest, &ctx);
+}
+
+static void b_sha512_0(void) { bn_data_size = 0; b_sha512(); }
+static void b_sha512_64(void) { bn_data_size = 64; b_sha512(); }
+static void b_sha512_256(void) { bn_data_size = 256; b_sha512(); }
+static void b_sha512_1K(void) { bn_data_size = 1024; b_sha512(); }
+static void b_sha512_8K(void) { bn_data_size = 8192; b_sha512(); }
+
+static void b_sha512_mb(void)
+{
+    int i;
+    SHA512_MB_Init(&bn_mgr);
+    for (i = 0; i < SHA512_MB_LANES; i++) SHA512_MB_Submit(&bn_mgr, &bn_jobs[i]);
+    while (SHA512_MB_Flush(&bn_mgr)) ;
+}
+
+/* -- public API ------------------------------------------------------------ */
+
+static void b_dh_PublicKey(void) { curve25519_dh_CalculatePublicKey(bn_out, bn_dh_sk); }
+static void b_dh_PublicKey_fast(void) { curve25519_dh_CalculatePublicKey_fast(bn_out, bn_dh_sk); }
+static void b_dh_SharedKey(void) { curve25519_dh_CreateSharedKey(bn_out, bn_dh_pk, bn_dh_sk); }
+static void b_CreateKeyPair(void) { ed25519_CreateKeyPair(bn_out, bn_priv, 0, bn_sk); }
+static void b_CreateKeyPair_blinded(void) { ed25519_CreateKeyPair(bn_out, bn_priv, bn_blinding, bn_sk); }
+static void b_SignMessage(void) { ed25519_SignMessage(bn_out, bn_priv, 0, bn_msg[0], BENCH_MSG_SIZE); }
+static void b_SignMessage_blinded(void) { ed25519_SignMessage(bn_out, bn_priv, bn_blinding, bn_msg[0], BENCH_MSG_SIZE); }
+static void b_Sign_Init(void) { ed25519_Sign_Init(bn_sign_tmp, bn_priv, 0); }
+static void b_Sign_WithCtx(void) { ed25519_Sign_WithCtx(bn_sign_ctx, bn_out, bn_msg[0], BENCH_MSG_SIZE); }
+static void b_SignBatch(void) { ed25519_SignBatch(bn_sign_ctx, bn_outs, bn_msgs, bn_sizes, BENCH_BATCH); }
+static void b_Sign_FromPool(void) { ed25519_Sign_FromPool(bn_pool, bn_out, bn_msg[0], BENCH_MSG_SIZE); }
+static void b_Sign_Derive(void) { ed25519_Sign_Derive(bn_sign_tmp, bn_sign_ctx, bn_tweaks); }
+static void b_DerivePublicKey(void) { ed25519_DerivePublicKey(bn_out, bn_pk, bn_tweaks); }
+static void b_DerivePublicKeys(void) { ed25519_DerivePublicKeys(bn_out, bn_pk, bn_tweaks, BENCH_BATCH); }
+static void b_KeySeq_Next(void) { ed25519_KeySeq_Next(bn_seq, bn_out, BENCH_BATCH); }
+static void b_Blinding_Init(void) { ed25519_Blinding_Finish(ed25519_Blinding_Init(0, bn_seed, sizeof(bn_seed))); }
+static void b_Blinding_Refresh(void) { ed25519_Blinding_Refresh(bn_blinding); }
+static void b_VerifySignature(void) { ed25519_VerifySignature(bn_sig[0], bn_pk, bn_msg[0], BENCH_MSG_SIZE); }
+static void b_Verify_Init(void) { ed25519_Verify_Init(bn_ver_tmp, bn_pk); }
+static void b_Verify_Init_strict(void) { ed25519_Verify_InitEx(bn_ver_tmp, bn_pk, ed25519_verify_strict); }
+static void b_Verify_Check(void) { ed25519_Verify_Check(bn_ver_ctx, bn_sig[0], bn_msg[0], BENCH_MSG_SIZE); }
+static void b_Verify_Check_strict(void) { ed25519_Verify_Check(bn_ver_strict, bn_sig[0], bn_msg[0], BENCH_MSG_SIZE); }
+static void b_Verify_CheckBatch(void) { ed25519_Verify_CheckBatch(bn_ver_ctx, BENCH_BATCH, (const U8 * const *)bn_sigs, bn_msgs, bn_sizes, bn_results); }
+static void b_Verify_CheckCached(void) { ed25519_Verify_CheckCached(bn_ver_ctx, bn_cache, bn_sig[0], bn_msg[0], BENCH_MSG_SIZE); }
+
+/* Untimed, before each sample */
+static void p_Pool(int reps) { ed25519_SignPool_Refill(bn_pool, reps); }
+
+typedef struct {
+    const char *group;
+    const char *name;
+    void (*fn)(void);
+    void (*prep)(int reps);
+} BENCH_ENTRY;
+
+static const BENCH_ENTRY bench_list[] =
+{
+    { "field",  "ecp_AddReduce",            b_ecp_AddReduce },
+    { "field",  "ecp_SubReduce",            b_ecp_SubReduce },
+    { "field",  "ecp_MulReduce",            b_ecp_MulReduce },
+    { "field",  "ecp_SqrReduce",            b_ecp_SqrReduce },
+    { "field",  "ecp_Inverse",              b_ecp_Inverse },
+    { "field",  "ecp_ModExp2523",           b_ecp_ModExp2523 },
+    { "fold",   "ecp_4SignedFolds",         b_ecp_4SignedFolds },
+    { "fold",   "ecp_8SignedFolds",         b_ecp_8SignedFolds },
+    { "point",  "edp_DoublePoint",          b_edp_DoublePoint },
+    { "point",  "edp_AddPoint",             b_edp_AddPoint },
+    { "point",  "edp_AddAffinePoint",       b_edp_AddAffinePoint },
+    { "point",  "edp_AddBasePoint",         b_edp_AddBasePoint },
+    { "point",  "edp_ExtPoint2PE",          b_edp_ExtPoint2PE },
+    { "point",  "edp_ScanSlice",            b_edp_ScanSlice },
+    { "point",  "edp_BasePointMultiply",    b_edp_BasePointMultiply },
+    { "scalar", "eco_AddReduce",            b_eco_AddReduce },
+    { "scalar", "eco_MulReduce",            b_eco_MulReduce },
+    { "scalar", "eco_MulAddReduce",         b_eco_MulAddReduce },
+    { "scalar", "eco_MontMul",              b_eco_MontMul },
+    { "scalar", "eco_Reduce512",            b_eco_Reduce512 },
+    { "scalar", "eco_DigestToWords",        b_eco_DigestToWords },
+    { "scalar", "eco_InvModBPO",            b_eco_InvModBPO },
+    { "sha512", "SHA512 (0 bytes)",         b_sha512_0 },
+    { "sha512", "SHA512 (64 bytes)",        b_sha512_64 },
+    { "sha512", "SHA512 (256 bytes)",       b_sha512_256 },
+    { "sha512", "SHA512 (1K)",              b_sha512_1K },
+    { "sha512", "SHA512 (8K)",              b_sha512_8K },
+    { "sha512", "SHA512_MB (1K) x4",        b_sha512_mb },
+    { "dh",     "dh_CalculatePublicKey",    b_dh_PublicKey },
+    { "dh",     "dh_CalculatePublicKey_fast", b_dh_PublicKey_fast },
+    { "dh",     "dh_CreateSharedKey",       b_dh_SharedKey },
+    { "sign",   "CreateKeyPair",            b_CreateKeyPair },
+    { "sign",   "CreateKeyPair (blinded)",  b_CreateKeyPair_blinded },
+    { "sign",   "SignMessage",              b_SignMessage },
+    { "sign",   "SignMessage (blinded)",    b_SignMessage_blinded },
+    { "sign",   "Sign_Init",                b_Sign_Init },
+    { "sign",   "Sign_WithCtx (blinded)",   b_Sign_WithCtx },
+    { "sign",   "SignBatch x16",            b_SignBatch },
+    { "sign",   "Sign_FromPool",            b_Sign_FromPool, p_Pool },
+    { "sign",   "Sign_Derive",              b_Sign_Derive },
+    { "sign",   "DerivePublicKey",          b_DerivePublicKey },
+    { "sign",   "DerivePublicKeys x16",     b_DerivePublicKeys },
+    { "sign",   "KeySeq_Next x16",          b_KeySeq_Next },
+    { "sign",   "Blinding_Init",            b_Blinding_Init },
+    { "sign",   "Blinding_Refresh",         b_Blinding_Refresh },
+    { "verify", "VerifySignature",          b_VerifySignature },
+    { "verify", "Verify_Init",              b_Verify_Init },
+    { "verify", "Verify_InitEx (strict)",   b_Verify_Init_strict },
+    { "verify", "Verify_Check",             b_Verify_Check },
+    { "verify", "Verify_Check (strict)",    b_Verify_Check_strict },
+    { "verify", "Verify_CheckBatch x16",    b_Verify_CheckBatch },
+    { "verify", "Verify_CheckCached (hit)", b_Verify_CheckCached },
+};
+
+#define BENCH_COUNT (sizeof(bench_list)/sizeof(bench_list[0]))
+
+/* -- measurement ----------------------------------------------------------- */
+
+typedef struct {
+    double cyc[3];          /* median, p90, p99 */
+    double ns[3];
+    double ipc;             /* < 0: not available */
+    double l1_miss;         /* per call, < 0: not available */
+    int reps;
+} BENCH_RESULT;
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of sorted s[n] */
+static double percentile(const double *s, int n, int pct)
+{
+    int k = (pct*n + 99)/100;
+    return s[k > 0 ? k - 1 : 0];
+}
+
+static void bench_Run(const BENCH_ENTRY *b, int samples, BENCH_PERF_CTX *pc, 
+    BENCH_RESULT *res)
+{
+    int i, j, reps = 1;
+    U64 c0, c1, n0, n1, val[PERF_EVENTS];
+    double *cyc = (double*)malloc(2*samples*sizeof(double));
+    double *ns = cyc + samples;
+
+    /* Warm up, then size samples to BENCH_TARGET */
+    for (i = 0; i < 4; i++)
+    {
+        if (b->prep) b->prep(1);
+        c0 = bench_cycles();
+        b->fn();
+        c1 = bench_cycles();
+    }
+    if (c1 > c0 && c1 - c0 < BENCH_TARGET)
+        reps = (int)(BENCH_TARGET/(c1 - c0));
+    if (reps > BENCH_MAX_REPS) reps = BENCH_MAX_REPS;
+
+    perf_Start(pc);
+    for (i = 0; i < samples; i++)
+    {
+        if (b->prep) b->prep(reps);
+        n0 = bench_ns();
+        c0 = bench_cycles();
+        for (j = 0; j < reps; j++) b->fn();
+        c1 = bench_cycles();
+        n1 = bench_ns();
+        cyc[i] = (double)(c1 - c0)/reps;
+        ns[i] = (double)(n1 - n0)/reps;
+    }
+    res->ipc = res->l1_miss = -1;
+    i = perf_Stop(pc, val);
+    if (i >= 2 && val[PERF_CYCLES])
+        res->ipc = (double)val[PERF_INSTR]/val[PERF_CYCLES];
+    if (i >= 3)
+        res->l1_miss = (double)val[PERF_L1D_MISS]/((double)samples*reps);
+
+    qsort(cyc, samples, sizeof(double), cmp_double);
+    qsort(ns, samples, sizeof(double), cmp_double);
+    res->cyc[0] = percentile(cyc, samples, 50);
+    res->cyc[1] = percentile(cyc, samples, 90);
+    res->cyc[2] = percentile(cyc, samples, 99);
+    res->ns[0] = percentile(ns, samples, 50);
+    res->ns[1] = percentile(ns, samples, 90);
+    res->ns[2] = percentile(ns, samples, 99);
+    res->reps = reps;
+    free(cyc);
+}
+
+/* -- output ---------------------------------------------------------------- */
+
+#define FMT_TEXT    0
+#define FMT_CSV     1
+#define FMT_JSON    2
+
+static void print_Header(int fmt, int samples, int perf)
+{
+    if (fmt == FMT_CSV)
+    {
+        printf("group,name,samples,reps,median_cycles,p90_cycles,p99_cycles,"
+            "median_ns,p90_ns,p99_ns,calls_per_sec,ipc,l1d_misses\n");
+    }
+    else if (fmt == FMT_JSON)
+    {
+        printf("{\n  \"library\": \"%s\",\n  \"samples\": %d,\n"
+            "  \"perf\": %s,\n  \"results\": [", 
+#ifdef USE_ASM_LIB
+            "asm",
+#else
+            "c",
+#endif
+            samples, perf ? "true" : "false");
+    }
+    else
+    {
+        printf("%-7s %-28s %10s %10s %10s %10s %12s", "group", "name",
+            "median", "p90", "p99", "median", "calls/sec");
+        if (perf) printf(" %6s %9s", "IPC", "L1D miss");
+        printf("\n%-7s %-28s %10s %10s %10s %10s %12s", "", "", 
+            "cycles", "cycles", "cycles", "ns", "");
+        printf("\n");
+    }
+}
+
+static void print_Result(int fmt, int first, int samples, int perf,
+    const BENCH_ENTRY *b, const BENCH_RESULT *r)
+{
+    double cps = r->ns[0] > 0 ? 1e9/r->ns[0] : 0;
+
+    if (fmt == FMT_CSV)
+    {
+        printf("%s,\"%s\",%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.0f,", b->group, 
+            b->name, samples, r->reps, r->cyc[0], r->cyc[1], r->cyc[2], 
+            r->ns[0], r->ns[1], r->ns[2], cps);
+        if (r->ipc >= 0) printf("%.3f", r->ipc);
+        printf(",");
+        if (r->l1_miss >= 0) printf("%.2f", r->l1_miss);
+        printf("\n");
+    }
+    else if (fmt == FMT_JSON)
+    {
+        printf("%s\n    { \"group\": \"%s\", \"name\": \"%s\", \"reps\": %d,\n"
+            "      \"cycles\": { \"median\": %.1f, \"p90\": %.1f, \"p99\": %.1f },\n"
+            "      \"ns\": { \"median\": %.1f, \"p90\": %.1f, \"p99\": %.1f },\n"
+            "      \"calls_per_sec\": %.0f", first ? "" : ",", b->group, b->name, 
+            r->reps, r->cyc[0], r->cyc[1], r->cyc[2], r->ns[0], r->ns[1], 
+            r->ns[2], cps);
+        if (r->ipc >= 0) printf(", \"ipc\": %.3f", r->ipc);
+        if (r->l1_miss >= 0) printf(", \"l1d_misses\": %.2f", r->l1_miss);
+        printf(" }");
+    }
+    else
+    {
+        printf("%-7s %-28s %10.0f %10.0f %10.0f %10.0f %12.0f", b->group, 
+            b->name, r->cyc[0], r->cyc[1], r->cyc[2], r->ns[0], cps);
+        if (perf)
+        {
+            if (r->ipc >= 0) printf(" %6.2f", r->ipc); else printf(" %6s", "-");
+            if (r->l1_miss >= 0) printf(" %9.2f", r->l1_miss); else printf(" %9s", "-");
+        }
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+static void print_Footer(int fmt)
+{
+    if (fmt == FMT_JSON) printf("\n  ]\n}\n");
+}
+
+/* -- multi-threaded scaling ------------------------------------------------ */
+
+#define SCALE_MSG_MAX   16384
+#define SCALE_DURATION  200         /* msec per point */
+
+#if BENCH_THREADS
+
+#define SCALE_SHARED    1           /* all threads use one key and context */
+#define SCALE_COLD      2           /* new verify context for every check */
+
+typedef struct SCALE_THREAD_S SCALE_THREAD;
+
+typedef struct {
+    const char *op;
+    int flags;
+    size_t msg_size;
+    void (*fn)(SCALE_THREAD *t);
+} SCALE_ENTRY;
+
+struct SCALE_THREAD_S {
+    const SCALE_ENTRY *w;
+    int index;
+    int cpu;
+    U64 ops;
+    void *sign_ctx;
+    void *ver_ctx;
+    U8 sk[32], pk[32], priv[64], sig[64], out[64];
+    pthread_t tid;
+};
+
+static U8 sc_msg[SCALE_MSG_MAX];
+static void *sc_sign_ctx, *sc_ver_ctx;
+static long sc_ready, sc_go, sc_stop;
+
+static void w_Sign(SCALE_THREAD *t)
+{
+    ed25519_Sign_WithCtx(t->sign_ctx, t->out, sc_msg, t->w->msg_size);
+}
+
+static void w_Verify(SCALE_THREAD *t)
+{
+    void *ctx = t->ver_ctx;
+    if (t->w->flags & SCALE_COLD) ctx = ed25519_Verify_Init(0, t->pk);
+    ed25519_Verify_Check(ctx, t->sig, sc_msg, t->w->msg_size);
+    if (t->w->flags & SCALE_COLD) ed25519_Verify_Finish(ctx);
+}
+
+static void w_DH(SCALE_THREAD *t)
+{
+    curve25519_dh_CreateSharedKey(t->out, bn_dh_pk, t->sk);
+}
+
+static const SCALE_ENTRY scale_list[] =
+{
+    { "sign",       SCALE_SHARED,               64,     w_Sign },
+    { "sign",       0,                          64,     w_Sign },
+    { "sign",       0,                          SCALE_MSG_MAX, w_Sign },
+    { "verify",     SCALE_SHARED,               64,     w_Verify },
+    { "verify",     0,                          64,     w_Verify },
+    { "verify",     0,                          SCALE_MSG_MAX, w_Verify },
+    { "verify",     SCALE_SHARED|SCALE_COLD,    64,     w_Verify },
+    { "verify",     SCALE_COLD,                 64,     w_Verify },
+    { "dh",         0,                          32,     w_DH },
+};
+
+#define SCALE_COUNT (sizeof(scale_list)/sizeof(scale_list[0]))
+
+/* Keys and contexts are set up by the thread itself (first touch) */
+static void scale_ThreadSetup(SCALE_THREAD *t)
+{
+    int i;
+    if (t->w->flags & SCALE_SHARED)
+    {
+        memcpy(t->pk, bn_pk, 32);
+        t->sign_ctx = sc_sign_ctx;
+        t->ver_ctx = sc_ver_ctx;
+    }
+    else
+    {
+        for (i = 0; i < 32; i++) t->sk[i] = (U8)(bn_seed[i] + t->index);
+        ed25519_CreateKeyPair(t->pk, t->priv, 0, t->sk);
+        t->sign_ctx = ed25519_Sign_Init(0, t->priv, 0);
+        t->ver_ctx = ed25519_Verify_Init(0, t->pk);
+    }
+    ed25519_Sign_WithCtx(t->sign_ctx, t->sig, sc_msg, t->w->msg_size);
+}
+
+static void scale_ThreadCleanup(SCALE_THREAD *t)
+{
+    if (t->w->flags & SCALE_SHARED) return;
+    ed25519_Verify_Finish(t->ver_ctx);
+    ed25519_Sign_Finish(t->sign_ctx);
+}
+
+static void *scale_Thread(void *arg)
+{
+    SCALE_THREAD *t = (SCALE_THREAD*)arg;
+    U64 ops = 0;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(t->cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+    scale_ThreadSetup(t);
+    __atomic_add_fetch(&sc_ready, 1, __ATOMIC_RELEASE);
+    while (!__atomic_load_n(&sc_go, __ATOMIC_ACQUIRE)) sched_yield();
+
+    while (!__atomic_load_n(&sc_stop, __ATOMIC_RELAXED))
+    {
+        t->w->fn(t);
+        ops++;
+    }
+    t->ops = ops;
+    scale_ThreadCleanup(t);
+    return 0;
+}
+
+/* Runs w on n pinned threads for msec, returns total ops/sec */
+static double scale_Run(const SCALE_ENTRY *w, int n, int cores, int msec)
+{
+    int i;
+    U64 t0, t1, ops = 0;
+    struct timespec ts;
+    SCALE_THREAD *t = (SCALE_THREAD*)calloc(n, sizeof(SCALE_THREAD));
+
+    sc_ready = sc_go = sc_stop = 0;
+    for (i = 0; i < n; i++)
+    {
+        t[i].w = w;
+        t[i].index = i;
+        t[i].cpu = i % cores;
+        pthread_create(&t[i].tid, 0, scale_Thread, &t[i]);
+    }
+    while (__atomic_load_n(&sc_ready, __ATOMIC_ACQUIRE) < n) sched_yield();
+
+    ts.tv_sec = msec/1000;
+    ts.tv_nsec = (msec % 1000)*1000000L;
+    t0 = bench_ns();
+    __atomic_store_n(&sc_go, 1, __ATOMIC_RELEASE);
+    nanosleep(&ts, 0);
+    __atomic_store_n(&sc_stop, 1, __ATOMIC_RELAXED);
+    t1 = bench_ns();
+
+    for (i = 0; i < n; i++)
+    {
+        pthread_join(t[i].tid, 0);
+        ops += t[i].ops;
+    }
+    free(t);
+    return (double)ops*1e9/(double)(t1 - t0);
+}
+
+static void print_ScaleHeader(int fmt, int cores, int msec)
+{
+    if (fmt == FMT_CSV)
+        printf("op,keys,contexts,msg_size,threads,ops_per_sec,ops_per_sec_per_thread,efficiency\n");
+    else if (fmt == FMT_JSON)
+        printf("{\n  \"cores\": %d,\n  \"duration_ms\": %d,\n  \"scaling\": [", cores, msec);
+    else
+        printf("%-7s %-9s %-5s %6s %7s %12s %12s %6s\n", "op", "keys", "ctx",
+            "msg", "threads", "ops/sec", "per thread", "eff");
+}
+
+static void print_ScaleResult(int fmt, int first, const SCALE_ENTRY *w, 
+    int n, double ops, double base)
+{
+    const char *keys = (w->flags & SCALE_SHARED) ? "shared" : "distinct";
+    const char *ctx = (w->fn != w_Verify) ? "-" : 
+        (w->flags & SCALE_COLD) ? "cold" : "hot";
+    double eff = base > 0 ? ops/(n*base) : 0;
+
+    if (fmt == FMT_CSV)
+        printf("%s,%s,%s,%d,%d,%.0f,%.0f,%.3f\n", w->op, keys, ctx, 
+            (int)w->msg_size, n, ops, ops/n, eff);
+    else if (fmt == FMT_JSON)
+        printf("%s\n    { \"op\": \"%s\", \"keys\": \"%s\", \"contexts\": \"%s\", "
+            "\"msg_size\": %d, \"threads\": %d,\n      \"ops_per_sec\": %.0f, "
+            "\"ops_per_sec_per_thread\": %.0f, \"efficiency\": %.3f }", 
+            first ? "" : ",", w->op, keys, ctx, (int)w->msg_size, n, ops, 
+            ops/n, eff);
+    else
+        printf("%-7s %-9s %-5s %6d %7d %12.0f %12.0f %6.2f\n", w->op, keys, 
+            ctx, (int)w->msg_size, n, ops, ops/n, eff);
+    fflush(stdout);
+}
+#endif /* BENCH_THREADS */
+
+/*  Throughput at 1, 2, 4, ... threads up to max_threads (default: online
+    cores), thread i pinned to core i mod cores. Efficiency is the per
+    thread throughput relative to the single thread run.
+*/
+static int scale_Main(int fmt, int max_threads, int msec, const char *filter)
+{
+#if BENCH_THREADS
+    int i, n, cores = (int)sysconf(_SC_NPROCESSORS_ONLN), first = 1;
+    double ops, base;
+
+    if (cores < 1) cores = 1;
+    if (max_threads < 1) max_threads = cores;
+    for (i = 0; i < (int)sizeof(sc_msg); i++) sc_msg[i] = (U8)(i*5 + 1);
+    sc_sign_ctx = ed25519_Sign_Init(0, bn_priv, 0);
+    sc_ver_ctx = ed25519_Verify_Init(0, bn_pk);
+
+    print_ScaleHeader(fmt, cores, msec);
+    for (i = 0; i < (int)SCALE_COUNT; i++)
+    {
+        const SCALE_ENTRY *w = &scale_list[i];
+        if (filter && !strstr(w->op, filter)) continue;
+        base = 0;
+        n = 1;
+        while (1)
+        {
+            ops = scale_Run(w, n, cores, msec);
+            if (n == 1) base = ops;
+            print_ScaleResult(fmt, first, w, n, ops, base);
+            first = 0;
+            if (n >= max_threads) break;
+            n = (2*n < max_threads) ? 2*n : max_threads;
+        }
+    }
+    if (fmt == FMT_JSON) printf("\n  ]\n}\n");
+
+    ed25519_Verify_Finish(sc_ver_ctx);
+    ed25519_Sign_Finish(sc_sign_ctx);
+    return 0;
+#else
+    fprintf(stderr, "scaling benchmark needs a build with ECP_THREADS=1\n");
+    return 1;
+#endif
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-f text|csv|json] [-n samples] [-p] [filter]\n"
+        "       %s -s [-T threads] [-d msec] [-f text|csv|json] [filter]\n", 
+        prog, prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int i, fmt = FMT_TEXT, samples = BENCH_SAMPLES, perf = 0, first = 1;
+    int scale = 0, threads = 0, msec = SCALE_DURATION;
+    const char *filter = 0;
+    BENCH_PERF_CTX pc;
+    BENCH_RESULT r;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        {
+            i++;
+            if (strcmp(argv[i], "csv") == 0) fmt = FMT_CSV;
+            else if (strcmp(argv[i], "json") == 0) fmt = FMT_JSON;
+            else if (strcmp(argv[i], "text") == 0) fmt = FMT_TEXT;
+            else return usage(argv[0]);
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            samples = atoi(argv[++i]);
+            if (samples < 1) return usage(argv[0]);
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+            perf = 1;
+        else if (strcmp(argv[i], "-s") == 0)
+            scale = 1;
+        else if (strcmp(argv[i], "-T") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+        {
+            msec = atoi(argv[++i]);
+            if (msec < 1) return usage(argv[0]);
+        }
+        else if (argv[i][0] == '-')
+            return usage(argv[0]);
+        else
+            filter = argv[i];
+    }
+
+    if (scale)
+    {
+        bench_Setup();
+        i = scale_Main(fmt, threads, msec, filter);
+        bench_Cleanup();
+        return i;
+    }
+
+    if (!perf_Init(&pc, perf) && perf)
+    {
+        fprintf(stderr, "perf_event_open: hardware counters not available\n");
+        perf = 0;
+    }
+
+    bench_Setup();
+    print_Header(fmt, samples, perf);
+    for (i = 0; i < (int)BENCH_COUNT; i++)
+    {
+        const BENCH_ENTRY *b = &bench_list[i];
+        if (filter && !strstr(b->name, filter) && !strstr(b->group, filter))
+            continue;
+        bench_Run(b, samples, &pc, &r);
+        print_Result(fmt, first, samples, perf, b, &r);
+        first = 0;
+    }
+    print_Footer(fmt);
+    bench_Cleanup();
+    perf_Finish(&pc);
+    return 0;
+}
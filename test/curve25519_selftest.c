@@ -59,7 +59,6 @@ extern const U_WORD _w_maxP[K_WORDS];
 extern const U_WORD _w_I[K_WORDS];
 extern const U_WORD _w_2d[K_WORDS];
 extern const U_WORD _w_NxBPO[16][K_WORDS];
-extern const PA_POINT _w_base_folding8[256];
 
 #define _w_BPO      _w_NxBPO[1]
 #define _w_maxBPO   _w_NxBPO[15]
@@ -68,8 +67,8 @@ static const U8 _b_Pp3d8[32] = {    /* (P+3)/8 */
     0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
     0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F };
 
-#define _w_Zero     _w_base_folding8[0].T2d
-#define _w_One      _w_base_folding8[0].YpX
+#define _w_Zero     _w_base_multiples[0].T2d
+#define _w_One      _w_base_multiples[0].YpX
 
 static const U_WORD inv_5[K_WORDS] = /* 1/5 mod p */
     W256(0x99999996,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x19999999);
@@ -140,22 +139,6 @@ static const U8 sha512_ax1m[] = {   /* 'a' repeated 1,000,000 times */
     0xDE,0x0F,0xF2,0x44,0x87,0x7E,0xA6,0x0A,0x4C,0xB0,0x43,0x2C,0xE5,0x77,0xC3,0x1B,
     0xEB,0x00,0x9C,0x5C,0x2C,0x49,0xAA,0x2E,0x4E,0xAD,0xB2,0x17,0xAD,0x8C,0xC0,0x9B };
 
-static const U8 _b_BPOm2[32] = {      /* BasePointOrder - 2 */
-    0xEB,0xD3,0xF5,0x5C,0x1A,0x63,0x12,0x58,0xD6,0x9C,0xF7,0xA2,0xDE,0xF9,0xDE,0x14,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10 };
-
-/* R = 2**256 mod BPO */
-/* R = 0x0FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEC6EF5BF4737DCF70D6EC31748D98951D */
- static const U_WORD _w_R[K_WORDS] = /* R mod BPO */
-    W256(0x8D98951D,0xD6EC3174,0x737DCF70,0xC6EF5BF4,
-         0xFFFFFFFE,0xFFFFFFFF,0xFFFFFFFF,0x0FFFFFFF);
-
-/* R2 = R**2 mod BPO */
-/* R2 = 0x0399411B7C309A3DCEEC73D217F5BE65D00E1BA768859347A40611E3449C0F01 */
-static const U_WORD _w_R2[K_WORDS] = /* R**2 mod BPO */
-    W256(0x449C0F01,0xA40611E3,0x68859347,0xD00E1BA7,
-         0x17F5BE65,0xCEEC73D2,0x7C309A3D,0x0399411B);
-
 int ecp_IsZero(IN const U_WORD *X)
 {
     return (X[0] | X[1] | X[2] | X[3]
@@ -179,107 +162,6 @@ void eco_MulMod(OUT U_WORD *Z, IN const U_WORD *X, IN const U_WORD *Y)
     eco_Mod(Z);
 }
 
-#ifdef WORDSIZE_32
-#define BPO_MINV32  0x12547E1B  /* -1/BPO mod 2**32 */
-
-#define ECP_MULADD_W0(Z,Y,b,X) c.u64 = (U64)(b)*(X) + (Y); Z = c.u32.lo;
-#define ECP_MULADD_W1(Z,Y,b,X) c.u64 = (U64)(b)*(X) + (U64)(Y) + c.u32.hi; Z = c.u32.lo;
-
-/* Computes Z = Y + b*X and return carry */
-static U32 eco_WordMulAdd(U32 *Z, const U32* Y, U32 b, const U32* X) 
-{
-    M64 c;
-    ECP_MULADD_W0(Z[0], Y[0], b, X[0]);
-    ECP_MULADD_W1(Z[1], Y[1], b, X[1]);
-    ECP_MULADD_W1(Z[2], Y[2], b, X[2]);
-    ECP_MULADD_W1(Z[3], Y[3], b, X[3]);
-    ECP_MULADD_W1(Z[4], Y[4], b, X[4]);
-    ECP_MULADD_W1(Z[5], Y[5], b, X[5]);
-    ECP_MULADD_W1(Z[6], Y[6], b, X[6]);
-    ECP_MULADD_W1(Z[7], Y[7], b, X[7]);
-    c.u64 = (U64)Y[8] + c.u32.hi;
-    Z[8] = c.u32.lo;
-    return c.u32.hi;    /* 0 or 1 as the carry out */
-}
-
-/* Z = (X*Y)/R mod BPO */
-void eco_MontMul(OUT U32 *Z, IN const U32 *X, IN const U32 *Y)
-{
-    int i;
-    U32 T[10] = {0};
-    for (i = 0; i < 8; i++)
-    {
-        T[9]  = eco_WordMulAdd(T, T+1, X[i], Y);     /* T = (T>>32) + X[i]*Y */
-        T[9] += eco_WordMulAdd(T, T, BPO_MINV32 * T[0], _w_BPO);
-        /* T + (-1/BPO)*T*BPO mod 2**32 = 0 --> T[0] = 0 */
-    }
-    /* T[9] could be 2 at most */
-    while (T[9] != 0) T[9] += ecp_Sub(T+1, T+1, _w_maxBPO);
-    ecp_Copy(Z, T+1);
-}
-#else
-#define BPO_MINV64  0xD2B51DA312547E1B /* -1/BPO mod 2**64 */
-
-/* Z = (X*Y)/R mod BPO */
-void eco_MontMul(OUT U64 *Z, IN const U64 *X, IN const U64 *Y)
-{
-    U64 T[6];
-    ecp_WordMulSet(T, X[0], Y);                 /* T = X[0]*Y */
-    T[5]  = ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_BPO);
-    T[5]  = ecp_WordMulAdd(T, T+1, X[1], Y);    /* T = (T>>64) + X[1]*Y */
-    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_BPO);
-    T[5]  = ecp_WordMulAdd(T, T+1, X[2], Y);    /* T = (T>>64) + X[2]*Y */
-    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_BPO);
-    T[5]  = ecp_WordMulAdd(T, T+1, X[3], Y);    /* T = (T>>64) + X[3]*Y */
-    T[5] += ecp_WordMulAdd(T, T, BPO_MINV64 * T[0], _w_BPO);
-    /* T + (-1/BPO)*T*BPO mod 2**64 = 0 --> T[0] = 0 */
-    /* T[5] could be 2 at most */
-    while (T[5] != 0) T[5] += ecp_Sub(T+1, T+1, _w_maxBPO);
-    ecp_Copy(Z, T+1);   /* return T>>64 */
-    //eco_ReduceHiWord(Z, T[5], T+1);
-}
-#endif
-
-/* Return Y = X*R mod BPO */
-void eco_ToMont(OUT U_WORD *Y, IN const U_WORD *X)
-{
-    eco_MontMul(Y, X, _w_R2);
-}
-
-/* Return Y = X/R mod BPO */
-void eco_FromMont(OUT U_WORD *Y, IN const U_WORD *X)
-{
-    eco_MontMul(Y, X, _w_One);
-}
-
-#define ECO_SQRMUL(n) eco_MulReduce(Y,Y,Y); if(e & n) eco_MulReduce(Y,Y,X)
-
-/* Calculate Y = X**E mod BPO */
-void eco_ExpModBPO(OUT U_WORD *Y, IN const U_WORD *X, IN const U8 *E, IN int bytes)
-{
-    U8 e;
-    ecp_SetValue(Y, 1);
-
-    while (bytes > 0)
-    {
-        e = E[--bytes];
-        ECO_SQRMUL(0x80);
-        ECO_SQRMUL(0x40);
-        ECO_SQRMUL(0x20);
-        ECO_SQRMUL(0x10);
-        ECO_SQRMUL(0x08);
-        ECO_SQRMUL(0x04);
-        ECO_SQRMUL(0x02);
-        ECO_SQRMUL(0x01);
-    }
-}
-
-/* Calculate Y = 1/X mod BPO */
-void eco_InvModBPO(OUT U_WORD *Y, IN const U_WORD *X)
-{
-    eco_ExpModBPO(Y, X, _b_BPOm2, 32);
-}
-
 // check if y^2 == x^3 + 486662x^2 + x  mod 2^255 - 19
 int x25519_IsOnCurve(IN const U_WORD *X, IN const U_WORD *Y)
 {
@@ -432,124 +314,6 @@ void pre_compute_base_point()
     }
 }
 
-static const Ext_POINT _w_BasePoint = {   /* y = 4/5 mod P */
-    W256(0x8F25D51A,0xC9562D60,0x9525A7B2,0x692CC760,0xFDD6DC5C,0xC0A4E231,0xCD6E53FE,0x216936D3),
-    W256(0x66666658,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666),
-    W256(0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000),
-    W256(0xA5B7DDA3,0x6DDE8AB3,0x775152F5,0x20F09F80,0x64ABE37D,0x66EA4E8E,0xD78B7665,0x67875F0F)
-};
-
-void Ext2Affine(PA_POINT *r, Ext_POINT *p)
-{
-    ecp_Inverse(p->z, p->z);
-    ecp_MulMod(p->x, p->x, p->z);
-    ecp_MulMod(p->y, p->y, p->z);
-    ecp_MulMod(p->t, p->x, p->y);
-    ecp_SetValue(p->z, 1);
-
-    ecp_AddReduce(r->YpX, p->y, p->x); ecp_Mod(r->YpX);
-    ecp_SubReduce(r->YmX, p->y, p->x); ecp_Mod(r->YmX);
-    ecp_MulMod(r->T2d, p->t, _w_2d);
-}
-
-void pre_compute_base_folding4()
-{
-    Ext_POINT S = _w_BasePoint;
-    PA_POINT P0, P1, P2, P3;
-    PA_POINT R;
-    int i, j;
-
-    /* Calculate: P0=base, P1=(2^64)*P0, P2=(2^64)*P1, P3=(2^64)*P2 */
-    Ext2Affine(&P0, &S);
-    for (j = 0; j < 64; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P1, &S);
-    for (j = 0; j < 64; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P2, &S);
-    for (j = 0; j < 64; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P3, &S);
-
-    printf("\nconst PA_POINT _w_base_folding4[16] = \n{\n");
-    for (i = 0; i < 16; i++)
-    {
-        ecp_SetValue(S.x, 0);
-        ecp_SetValue(S.y, 1);
-        ecp_SetValue(S.z, 1);
-        ecp_SetValue(S.t, 0);
-
-        if (i & 1) edp_AddAffinePoint(&S, &P0);
-        if (i & 2) edp_AddAffinePoint(&S, &P1);
-        if (i & 4) edp_AddAffinePoint(&S, &P2);
-        if (i & 8) edp_AddAffinePoint(&S, &P3);
-        Ext2Affine(&R, &S);
-
-        printf("  { /* P{%d} */\n", i);
-        print_words("    W256(",R.YpX, K_WORDS);
-        print_words("),\n    W256(",R.YmX, K_WORDS);
-        print_words("),\n    W256(",R.T2d, K_WORDS);
-        if (i == 15)
-        {
-            printf(")\n  }\n};\n");
-            break;
-        }
-        printf(")\n  },\n");
-    }
-}
-
-void pre_compute_base_folding8()
-{
-    Ext_POINT S = _w_BasePoint;
-    PA_POINT P0, P1, P2, P3, P4, P5, P6, P7;
-    PA_POINT R;
-    int i, j;
-
-    // Calculate: P0=base, P1=(2^64)*P0, P2=(2^64)*P1, P3=(2^64)*P2
-    Ext2Affine(&P0, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P1, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P2, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P3, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P4, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P5, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P6, &S);
-    for (j = 0; j < 32; j++) edp_DoublePoint(&S);
-    Ext2Affine(&P7, &S);
-
-    printf("\nconst PA_POINT _w_base_folding8[16] = \n{\n");
-    for (i = 0; i < 256; i++)
-    {
-        ecp_SetValue(S.x, 0);
-        ecp_SetValue(S.y, 1);
-        ecp_SetValue(S.z, 1);
-        ecp_SetValue(S.t, 0);
-
-        if (i & 1) edp_AddAffinePoint(&S, &P0);
-        if (i & 2) edp_AddAffinePoint(&S, &P1);
-        if (i & 4) edp_AddAffinePoint(&S, &P2);
-        if (i & 8) edp_AddAffinePoint(&S, &P3);
-        if (i & 16) edp_AddAffinePoint(&S, &P4);
-        if (i & 32) edp_AddAffinePoint(&S, &P5);
-        if (i & 64) edp_AddAffinePoint(&S, &P6);
-        if (i & 128) edp_AddAffinePoint(&S, &P7);
-        Ext2Affine(&R, &S);
-
-        printf("  { /* P{%d} */\n", i);
-        print_words("    W256(",R.YpX, K_WORDS);
-        print_words("),\n    W256(",R.YmX, K_WORDS);
-        print_words("),\n    W256(",R.T2d, K_WORDS);
-        if (i == 255)
-        {
-            printf(")\n  }\n};\n");
-            break;
-        }
-        printf(")\n  },\n");
-    }
-}
-
 
 
 /* Y = X ** E mod P */
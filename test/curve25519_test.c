@@ -29,6 +29,7 @@
 #include "curve25519_donna.h"
 #include "../include/curve25519_dh.h"
 #include "../include/ed25519_signature.h"
+#include "../source/sha512.h"
 
 #ifdef USE_ASM_LIB
 
@@ -119,6 +120,7 @@ void ecp_PrintHexWords(IN const char *name, IN const U32 *data, IN U32 size)
 
 /* Needed for donna */
 extern void ecp_TrimSecretKey(U8 *X);
+extern const U_WORD _w_NxBPO[16][K_WORDS];
 const unsigned char BasePoint[32] = {9};
 
 unsigned char secret_blind[32] =
@@ -127,14 +129,48 @@ unsigned char secret_blind[32] =
     0x6d,0x54,0x2b,0xa1,0x63,0x03,0x93,0x85,0xcc,0x03,0x0a,0x7d,0xe1,0xae,0xa7,0xbb
 };
 
+#define ALLOC_KEYS  256
+
+#define ALLOC_KEYS  256
+
+/* The ReduceHiWord chain that eco_Reduce512 replaces; T is overwritten */
+static void ref_Reduce512(U_WORD *Y, U_WORD *T)
+{
+    int i;
+    for (i = K_WORDS-1; i > 0; i--)
+        eco_ReduceHiWord(T+i, T[K_WORDS+i], T+i);
+    eco_ReduceHiWord(Y, T[K_WORDS], T);
+}
+
+static int cmp_cycles(const void *a, const void *b)
+{
+    U64 x = *(const U64*)a, y = *(const U64*)b;
+    return (x > y) - (x < y);
+}
+
+/* Print p50 and p99 of n latency samples */
+static void print_latency(const char *name, U64 *t, int n, const char *mode)
+{
+    qsort(t, n, sizeof(U64), cmp_cycles);
+    printf ("%10s: %lld cycles = %.3f usec @3.4GHz (p50, %s)\n", 
+        name, t[n/2], (double)t[n/2]/3400.0, mode);
+    printf ("            %lld cycles = %.3f usec @3.4GHz (p99, %s)\n", 
+        t[n*99/100], (double)t[n*99/100]/3400.0, mode);
+}
+
 int speed_test(int loops)
 {
     U64 t1, t2, tovr = 0, td = (U64)(-1), tm = (U64)(-1);
     U8 secret_key[32], donna_publickey[32], mehdi_publickey[32];
     unsigned char pubkey[32], privkey[64], sig[64];
     void *ver_context = 0;
+    void *sign_context = 0;
     void *blinding = 0;
-    int i;
+    PA_POINT slice;
+    const PA_POINT *base;
+    U_WORD ox[K_WORDS], oy[K_WORDS], oa[K_WORDS], oz[K_WORDS], ot[2*K_WORDS];
+    static U_WORD obx[64][K_WORDS], oby[64][K_WORDS];
+    int i, j;
 
     /* generate key */
     mem_fill(secret_key, 0x42, 32);
@@ -242,6 +278,232 @@ int speed_test(int loops)
 
     printf ("      Sign: %lld cycles = %.3f usec @3.4GHz\n", tm, (double)tm/3400.0);
 
+    /* --------------------------------------------------------------------- */
+    /* Base table lookups of one sign: masked scan vs direct load */
+    /* --------------------------------------------------------------------- */
+    base = edp_BaseTable();
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        for (j = 0; j < ECP_BASE_SLICES; j++)
+            edp_ScanSlice(&slice, base, (U32)(j*37) & (ECP_BASE_ENTRIES-1));
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("    Lookup: %lld cycles = %.3f usec @3.4GHz (%d slices, masked scan)%s\n", 
+        tm, (double)tm/3400.0, ECP_BASE_SLICES, ECP_CT_LOOKUP ? "" : " -- not used");
+
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        for (j = 0; j < ECP_BASE_SLICES; j++)
+        {
+            ecp_Copy(slice.YpX, base[(j*37) & (ECP_BASE_ENTRIES-1)].YpX);
+            ecp_Copy(slice.YmX, base[(j*37) & (ECP_BASE_ENTRIES-1)].YmX);
+            ecp_Copy(slice.T2d, base[(j*37) & (ECP_BASE_ENTRIES-1)].T2d);
+        }
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("    Lookup: %lld cycles = %.3f usec @3.4GHz (%d slices, direct)%s\n", 
+        tm, (double)tm/3400.0, ECP_BASE_SLICES, ECP_CT_LOOKUP ? " -- not used" : "");
+
+    /* --------------------------------------------------------------------- */
+    /* S = h*a + r mod BPO: fused reduction vs the ReduceHiWord chain */
+    /* --------------------------------------------------------------------- */
+    ecp_BytesToWords(ox, sig);
+    ecp_BytesToWords(oy, sig+32);
+    ecp_BytesToWords(oa, privkey);
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        eco_MulAddReduce(oz, ox, oy, oa);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("     ModL: %lld cycles = %.3f usec @3.4GHz (eco_MulAddReduce)\n", 
+        tm, (double)tm/3400.0);
+
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        ecp_Mul(ot, ox, oy);
+        ref_Reduce512(oz, ot);
+        eco_AddReduce(oz, oz, oa);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("     ModL: %lld cycles = %.3f usec @3.4GHz (ReduceHiWord chain)\n", 
+        tm, (double)tm/3400.0);
+
+    /* --------------------------------------------------------------------- */
+    /* 1/X mod BPO: safegcd, Fermat and batched */
+    /* --------------------------------------------------------------------- */
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        eco_InvModBPO(oz, ox);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("    InvMod: %lld cycles = %.3f usec @3.4GHz (safegcd)\n", 
+        tm, (double)tm/3400.0);
+
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        eco_InvModBPO_Exp(oz, ox);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("    InvMod: %lld cycles = %.3f usec @3.4GHz (exponentiation)\n", 
+        tm, (double)tm/3400.0);
+
+    for (i = 0; i < 64; i++) eco_MulReduce(obx[i], ox, i ? obx[i-1] : oy);
+    tm = (U64)(-1);
+    for (i = 0; i < loops/10; i++)
+    {
+        t1 = readTSC();
+        eco_BatchInvModBPO(oby[0], obx[0], 64);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm = (tm - tovr)/64;
+
+    printf ("    InvMod: %lld cycles = %.3f usec @3.4GHz (Batch/64)\n", 
+        tm, (double)tm/3400.0);
+
+    /* --------------------------------------------------------------------- */
+    sign_context = ed25519_Sign_Init(0, privkey, 0);
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        ed25519_Sign_WithCtx(sign_context, sig, (const unsigned char*)"abc", 3);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("      Sign: %lld cycles = %.3f usec @3.4GHz (WithCtx)\n", tm, (double)tm/3400.0);
+
+    {
+        void *pool = ed25519_SignPool_Init(sign_context, loops, secret_blind, 32);
+
+        ed25519_SignPool_Refill(pool, loops);
+        tm = (U64)(-1);
+        for (i = 0; i < loops; i++)
+        {
+            t1 = readTSC();
+            ed25519_Sign_FromPool(pool, sig, (const unsigned char*)"abc", 3);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        ed25519_SignPool_Finish(pool);
+
+        printf ("      Sign: %lld cycles = %.3f usec @3.4GHz (online, from pool)\n", 
+            tm, (double)tm/3400.0);
+    }
+
+    /* --------------------------------------------------------------------- */
+    {
+        static U8 tweaks[64][32], keys[64][32];
+        void *seq = ed25519_KeySeq_Init(0, pubkey);
+
+        for (i = 0; i < 64; i++) mem_fill(tweaks[i], i, 32);
+        tm = (U64)(-1);
+        for (i = 0; i < loops; i++)
+        {
+            t1 = readTSC();
+            ed25519_DerivePublicKey(keys[0], pubkey, tweaks[0]);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        printf ("    Derive: %lld cycles = %.3f usec @3.4GHz\n", tm, (double)tm/3400.0);
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops/64; i++)
+        {
+            t1 = readTSC();
+            ed25519_DerivePublicKeys(keys[0], pubkey, tweaks[0], 64);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm = (tm - tovr)/64;
+        printf ("    Derive: %lld cycles = %.3f usec @3.4GHz (Batch/64)\n", tm, (double)tm/3400.0);
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops; i++)
+        {
+            t1 = readTSC();
+            ed25519_KeySeq_Next(seq, keys[0], 1);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        printf ("    KeySeq: %lld cycles = %.3f usec @3.4GHz\n", tm, (double)tm/3400.0);
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops/64; i++)
+        {
+            t1 = readTSC();
+            ed25519_KeySeq_Next(seq, keys[0], 64);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm = (tm - tovr)/64;
+        printf ("    KeySeq: %lld cycles = %.3f usec @3.4GHz (Batch/64)\n", tm, (double)tm/3400.0);
+        ed25519_KeySeq_Finish(seq);
+    }
+    ed25519_Sign_Finish(sign_context);
+
+    /* --------------------------------------------------------------------- */
+    {
+        unsigned char *sigs[64], sig_batch[64][ed25519_signature_size];
+        const unsigned char *msgs[64];
+        size_t sizes[64];
+
+        for (i = 0; i < 64; i++)
+        {
+            sigs[i] = sig_batch[i];
+            msgs[i] = (const unsigned char*)"abc";
+            sizes[i] = 3;
+        }
+        sign_context = ed25519_Sign_Init(0, privkey, 0);
+        tm = (U64)(-1);
+        for (i = 0; i < loops/64; i++)
+        {
+            t1 = readTSC();
+            ed25519_SignBatch(sign_context, sigs, msgs, sizes, 64);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm = (tm - tovr)/64;
+        ed25519_Sign_Finish(sign_context);
+
+        printf ("      Sign: %lld cycles = %.3f usec @3.4GHz (Batch/64)\n", tm, (double)tm/3400.0);
+    }
+
     /* --------------------------------------------------------------------- */
     /* Speed measurement for ed25519 keygen, sign using blinding */
     /* --------------------------------------------------------------------- */
@@ -274,6 +536,19 @@ int speed_test(int loops)
     printf ("      Sign: %lld cycles = %.3f usec @3.4GHz (Blinded)\n", 
         tm, (double)tm/3400.0);
 
+    tm = (U64)(-1);
+    for (i = 0; i < loops; i++)
+    {
+        t1 = readTSC();
+        ed25519_Blinding_Refresh(blinding);
+        t2 = readTSC() - t1;
+        if (t2 < tm) tm = t2;
+    }
+    tm -= tovr;
+
+    printf ("  Blinding: %lld cycles = %.3f usec @3.4GHz (Refresh)\n", 
+        tm, (double)tm/3400.0);
+
     ed25519_Blinding_Finish(blinding);
 
     /* --------------------------------------------------------------------- */
@@ -314,9 +589,185 @@ int speed_test(int loops)
 
     printf ("            %lld cycles = %.3f usec @3.4GHz (Check)\n", 
         tm, (double)tm/3400.0);
+    /* --------------------------------------------------------------------- */
+    {
+        void *strict = 0;
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops/10; i++)
+        {
+            t1 = readTSC();
+            strict = ed25519_Verify_InitEx(strict, pubkey, ed25519_verify_strict);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        printf ("            %lld cycles = %.3f usec @3.4GHz (Init, strict)\n", 
+            tm, (double)tm/3400.0);
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops; i++)
+        {
+            t1 = readTSC();
+            ed25519_Verify_Check(strict, sig, (const unsigned char*)"abc", 3);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        ed25519_Verify_Finish(strict);
+        printf ("            %lld cycles = %.3f usec @3.4GHz (Check, strict)\n", 
+            tm, (double)tm/3400.0);
+    }
+    /* --------------------------------------------------------------------- */
+    {
+        const unsigned char *sigs[16], *msgs[16];
+        size_t sizes[16];
+        unsigned char msg[16][128];
+        unsigned char sig_batch[16][ed25519_signature_size];
+
+        for (i = 0; i < 16; i++)
+        {
+            mem_fill(msg[i], i, sizeof(msg[i]));
+            ed25519_SignMessage(sig_batch[i], privkey, 0, msg[i], sizeof(msg[i]));
+            sigs[i] = sig_batch[i];
+            msgs[i] = msg[i];
+            sizes[i] = sizeof(msg[i]);
+        }
+
+        tm = (U64)(-1);
+        for (i = 0; i < loops/16; i++)
+        {
+            t1 = readTSC();
+            ed25519_Verify_CheckBatch(ver_context, 16, sigs, msgs, sizes, 0);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm = (tm - tovr)/16;
+
+        printf ("            %lld cycles = %.3f usec @3.4GHz (Check batch/16, 128-byte msg)\n", 
+            tm, (double)tm/3400.0);
+    }
+    /* --------------------------------------------------------------------- */
+    {
+        void *cache = ed25519_VerifyCache_Init(1024, secret_blind, 32);
+
+        ed25519_Verify_CheckCached(ver_context, cache, sig, (const unsigned char*)"abc", 3);
+        tm = (U64)(-1);
+        for (i = 0; i < loops; i++)
+        {
+            t1 = readTSC();
+            ed25519_Verify_CheckCached(ver_context, cache, sig, (const unsigned char*)"abc", 3);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        ed25519_VerifyCache_Finish(cache);
+
+        printf ("            %lld cycles = %.3f usec @3.4GHz (Check, cache hit)\n", 
+            tm, (double)tm/3400.0);
+    }
+    /* --------------------------------------------------------------------- */
+    /* Latency distribution: single-threaded vs low-latency mode */
+    /* --------------------------------------------------------------------- */
+    {
+        U64 *ts = (U64*)malloc(2*loops*sizeof(U64));
+        void *ctx = ed25519_Sign_Init(0, privkey, 0);
+
+        for (j = 0; j < 2; j++)
+        {
+            /* Start() refuses helpers without a free core */
+            if (j == 1 && ed25519_LowLatency_Start(1) == 0)
+            {
+                printf ("      low-latency: no free core, not measured\n");
+                break;
+            }
+            for (i = 0; i < loops; i++)
+            {
+                t1 = readTSC();
+                ed25519_Sign_WithCtx(ctx, sig, (const unsigned char*)"abc", 3);
+                ts[i] = readTSC() - t1 - tovr;
+
+                t1 = readTSC();
+                ed25519_Verify_Check(ver_context, sig, (const unsigned char*)"abc", 3);
+                ts[loops+i] = readTSC() - t1 - tovr;
+            }
+            print_latency("Sign", ts, loops, j ? "low-latency" : "single");
+            print_latency("Check", ts + loops, loops, j ? "low-latency" : "single");
+        }
+        ed25519_LowLatency_Stop();
+        ed25519_Sign_Finish(ctx);
+        free(ts);
+    }
+    /* --------------------------------------------------------------------- */
+    /* Checks across a key set: contexts from malloc vs the slab arena */
+    /* --------------------------------------------------------------------- */
+    {
+        static unsigned char kpub[ALLOC_KEYS][32], ksig[ALLOC_KEYS][64];
+        unsigned char kseed[32], kpriv[64];
+        void *kctx[ALLOC_KEYS];
+        void *arena = ed25519_Arena_Create();
+        int pass;
+
+        for (j = 0; j < ALLOC_KEYS; j++)
+        {
+            mem_fill(kseed, j, 32);
+            ed25519_CreateKeyPair(kpub[j], kpriv, 0, kseed);
+            ed25519_SignMessage(ksig[j], kpriv, 0, (const unsigned char*)"abc", 3);
+        }
+
+        for (pass = 0; pass < 2 && arena; pass++)
+        {
+            if (pass) ed25519_SetAllocator(ed25519_Arena_Alloc, ed25519_Arena_Free, arena);
+            for (j = 0; j < ALLOC_KEYS; j++)
+                kctx[j] = ed25519_Verify_Init(0, kpub[j]);
+
+            tm = (U64)(-1);
+            for (i = 0; i < 3; i++)
+            {
+                t1 = readTSC();
+                for (j = 0; j < ALLOC_KEYS; j++)
+                    ed25519_Verify_Check(kctx[j], ksig[j], (const unsigned char*)"abc", 3);
+                t2 = readTSC() - t1;
+                if (t2 < tm) tm = t2;
+            }
+            tm = (tm - tovr)/ALLOC_KEYS;
+
+            printf ("            %lld cycles = %.3f usec @3.4GHz (Check, %d keys, %s)\n", 
+                tm, (double)tm/3400.0, ALLOC_KEYS, pass ? "arena" : "malloc");
+
+            for (j = 0; j < ALLOC_KEYS; j++)
+                ed25519_Verify_Finish(kctx[j]);
+        }
+        ed25519_SetAllocator(0, 0, 0);
+        ed25519_Arena_Destroy(arena);
+    }
 
     ed25519_Verify_Finish(ver_context);
 
+    /* --------------------------------------------------------------------- */
+    {
+        SHA512_CTX H;
+        U8 *buff = (U8*)mem_alloc(1 << 20);
+
+        mem_fill(buff, 0x5a, 1 << 20);
+        tm = (U64)(-1);
+        for (i = 0; i < 20; i++)
+        {
+            t1 = readTSC();
+            SHA512_Init(&H);
+            SHA512_Update(&H, buff, 1 << 20);
+            SHA512_Final(sig, &H);
+            t2 = readTSC() - t1;
+            if (t2 < tm) tm = t2;
+        }
+        tm -= tovr;
+        mem_free(buff);
+
+        printf ("\n-- sha512 --\n"
+                "      1 MB: %lld cycles = %.3f cycles/byte\n", 
+            tm, (double)tm/(1 << 20));
+    }
+
     return 0;
 }
 
@@ -366,6 +817,51 @@ int signature_test(
         ecp_PrintBytes("pk", pubKey, ed25519_public_key_size);
     }
 
+    printf("-- Sign with expanded key --\n");
+    {
+        unsigned char sig2[ed25519_signature_size];
+        void *ctx = ed25519_Sign_Init(0, privKey, blinding);
+        ed25519_Sign_WithCtx(ctx, sig2, msg, size);
+        ed25519_Sign_Finish(ctx);
+        if (memcmp(sig, sig2, ed25519_signature_size) != 0)
+        {
+            rc++;
+            printf("ed25519_Sign_WithCtx() FAILED!!\n");
+            ecp_PrintBytes("Calculated", sig2, ed25519_signature_size);
+        }
+    }
+
+    printf("-- Sign batch --\n");
+    {
+        int i;
+        unsigned char m[21][150], s1[21][ed25519_signature_size], sig2[ed25519_signature_size];
+        unsigned char *sigs[21];
+        const unsigned char *msgs[21];
+        size_t sizes[21];
+        void *ctx = ed25519_Sign_Init(0, privKey, blinding);
+
+        for (i = 0; i < 21; i++)
+        {
+            mem_fill(m[i], i, sizeof(m[i]));
+            sigs[i] = s1[i];
+            msgs[i] = m[i];
+            sizes[i] = (i*37) % sizeof(m[i]);
+        }
+        msgs[0] = msg;
+        sizes[0] = size;
+        ed25519_SignBatch(ctx, sigs, msgs, sizes, 21);
+        for (i = 0; i < 21; i++)
+        {
+            ed25519_Sign_WithCtx(ctx, sig2, msgs[i], sizes[i]);
+            if (memcmp(sigs[i], sig2, ed25519_signature_size) != 0)
+            {
+                rc++;
+                printf("ed25519_SignBatch() FAILED!! (message %d)\n", i);
+            }
+        }
+        ed25519_Sign_Finish(ctx);
+    }
+
     printf("\n-- ed25519 -- sign/verify test w/blinding ----------------------\n");
     printf("\n-- CreateKeyPair --\n");
     ed25519_CreateKeyPair(pubKey, privKey, blinding, sk);
@@ -400,6 +896,31 @@ int signature_test(
         ecp_PrintBytes("pk", pubKey, ed25519_public_key_size);
     }
 
+    printf("-- Verify batch --\n");
+    {
+        int i, results[5];
+        unsigned char bad_sig[ed25519_signature_size];
+        const unsigned char *sigs[5], *msgs[5];
+        size_t sizes[5];
+        void *ctx = ed25519_Verify_Init(0, pubKey);
+
+        memcpy(bad_sig, sig, ed25519_signature_size);
+        bad_sig[40] ^= 1;
+        for (i = 0; i < 5; i++)
+        {
+            sigs[i] = (i == 3) ? bad_sig : sig;
+            msgs[i] = msg;
+            sizes[i] = size;
+        }
+        if (ed25519_Verify_CheckBatch(ctx, 5, sigs, msgs, sizes, results) != 0 ||
+            !results[0] || !results[1] || !results[2] || results[3] || !results[4])
+        {
+            rc++;
+            printf("Batch signature verification FAILED!!\n");
+        }
+        ed25519_Verify_Finish(ctx);
+    }
+
     if (rc == 0)
     {
         printf("  ++ Signature Verified Successfully. ++\n");
@@ -423,6 +944,1020 @@ unsigned char msg1_sig[ed25519_signature_size] = {
     0x38,0x7b,0x2e,0xae,0xb4,0x30,0x2a,0xee,0xb0,0x0d,0x29,0x16,0x12,0xbb,0x0c,0x00
 };
 
+static const unsigned char sha512_abc[SHA512_DIGEST_LENGTH] = {
+    0xdd,0xaf,0x35,0xa1,0x93,0x61,0x7a,0xba,0xcc,0x41,0x73,0x49,0xae,0x20,0x41,0x31,
+    0x12,0xe6,0xfa,0x4e,0x89,0xa9,0x7e,0xa2,0x0a,0x9e,0xee,0xe6,0x4b,0x55,0xd3,0x9a,
+    0x21,0x92,0x99,0x2a,0x27,0x4f,0xc1,0xa8,0x36,0xba,0x3c,0x23,0xa3,0xfe,0xeb,0xbd,
+    0x45,0x4d,0x44,0x23,0x64,0x3c,0xe8,0x0e,0x2a,0x9a,0xc9,0x4f,0xa5,0x4c,0xa4,0x9f };
+
+#ifdef ECP_SHA512_ASM
+/* Multi-block assembly transform on 1..8 blocks vs. SHA512_Transform_C */
+static int sha512_block_test(
+    const char *name,
+    void (*block)(SHA_LONG64 *h, const void *in, size_t num),
+    const U8 *data)
+{
+    int i, n;
+    SHA512_CTX H1, H2;
+
+    for (n = 1; n <= 8; n++)
+    {
+        SHA512_Init(&H1);
+        SHA512_Init(&H2);
+        block(H1.h, data + n - 1, n);
+        for (i = 0; i < n; i++) SHA512_Transform_C(&H2, data + n - 1 + 128*i);
+        if (memcmp(H1.h, H2.h, sizeof(H1.h)) != 0)
+        {
+            printf("%s(%d blocks) FAILED!!\n", name, n);
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif
+
+/* SHA512_Transform (assembly when enabled) must match SHA512_Transform_C */
+int hash_test()
+{
+    int i, k, rc = 0;
+    U8 data[1031], md1[SHA512_DIGEST_LENGTH], md2[SHA512_DIGEST_LENGTH];
+    SHA512_CTX H1, H2;
+
+    SHA512_Init(&H1);
+    SHA512_Update(&H1, "abc", 3);
+    SHA512_Final(md1, &H1);
+    if (memcmp(md1, sha512_abc, SHA512_DIGEST_LENGTH) != 0)
+    {
+        rc++;
+        printf("KAT: SHA512('abc') FAILED!!\n");
+    }
+
+    for (i = 0; i < (int)sizeof(data); i++) data[i] = (U8)(i*i + 3);
+
+    SHA512_Init(&H1);
+    SHA512_Init(&H2);
+    for (i = 0; i < 8; i++)
+    {
+        SHA512_Transform(&H1, data + 128*i + i);
+        SHA512_Transform_C(&H2, data + 128*i + i);
+        if (memcmp(H1.h, H2.h, sizeof(H1.h)) != 0)
+        {
+            rc++;
+            printf("SHA512_Transform() FAILED!!\n");
+            break;
+        }
+    }
+
+#ifdef ECP_SHA512_ASM
+    /* both transforms, whichever one SHA512_Transform picked */
+    rc += sha512_block_test("sha512_block_x64", sha512_block_x64, data);
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2"))
+        rc += sha512_block_test("sha512_block_avx2", sha512_block_avx2, data);
+    else
+        printf("sha512_block_avx2: no AVX2/BMI2, skipped\n");
+#endif
+
+    /* fixed-length fast paths */
+    SHA512_Init(&H1);
+    SHA512_Update(&H1, data, 32);
+    SHA512_Final(md1, &H1);
+    SHA512_32(md2, data);
+    if (memcmp(md1, md2, SHA512_DIGEST_LENGTH) != 0)
+    {
+        rc++;
+        printf("SHA512_32() FAILED!!\n");
+    }
+
+    for (i = 0; i < 260; i++)
+    {
+        SHA512_Init(&H1);
+        SHA512_Update(&H1, data + 500, 32);
+        SHA512_Update(&H1, data, i);
+        SHA512_Final(md1, &H1);
+        SHA512_Hdr32(md2, data + 500, data, i);
+        if (memcmp(md1, md2, SHA512_DIGEST_LENGTH) != 0)
+        {
+            rc++;
+            printf("SHA512_Hdr32(%d) FAILED!!\n", i);
+        }
+        SHA512_Init(&H1);
+        SHA512_Update(&H1, data + 600, 32);
+        SHA512_Update(&H1, data + 700, 32);
+        SHA512_Update(&H1, data, i);
+        SHA512_Final(md1, &H1);
+        SHA512_Hdr64(md2, data + 600, data + 700, data, i);
+        if (memcmp(md1, md2, SHA512_DIGEST_LENGTH) != 0)
+        {
+            rc++;
+            printf("SHA512_Hdr64(%d) FAILED!!\n", i);
+        }
+    }
+
+    /* multi-block input vs. byte at a time, odd alignments */
+    for (k = 0; k < 4; k++)
+    {
+        SHA512_Init(&H1);
+        SHA512_Update(&H1, data + k, sizeof(data) - k);
+        SHA512_Final(md1, &H1);
+        SHA512_Init(&H2);
+        for (i = k; i < (int)sizeof(data); i++) SHA512_Update(&H2, data + i, 1);
+        SHA512_Final(md2, &H2);
+        if (memcmp(md1, md2, SHA512_DIGEST_LENGTH) != 0)
+        {
+            rc++;
+            printf("SHA512_Update(%d bytes) FAILED!!\n", (int)sizeof(data) - k);
+        }
+    }
+    return rc;
+}
+
+/* Multi-buffer SHA-512 must match SHA512_Init/Update/Final */
+int hash_mb_test()
+{
+    static const size_t sizes[] = { 0, 1, 47, 48, 63, 64, 111, 112, 127, 128, 
+        175, 176, 200, 239, 240, 255, 256, 1000, 3 };
+    int i, k, n = sizeof(sizes)/sizeof(sizes[0]), rc = 0;
+    U8 data[1000], md[SHA512_DIGEST_LENGTH];
+    SHA512_CTX H;
+    SHA512_MB_MGR mgr;
+    SHA512_MB_JOB jobs[sizeof(sizes)/sizeof(sizes[0])], *job;
+
+    for (i = 0; i < (int)sizeof(data); i++) data[i] = (U8)(i*7 + 1);
+
+    SHA512_MB_Init(&mgr);
+    for (i = k = 0; k < n; )
+    {
+        if (i < n)
+        {
+            jobs[i].prefix_len = (unsigned int)((i*13) % (SHA512_MB_MAX_PREFIX + 1));
+            mem_fill(jobs[i].prefix, i, jobs[i].prefix_len);
+            jobs[i].data = data;
+            jobs[i].len = sizes[i];
+            job = SHA512_MB_Submit(&mgr, &jobs[i++]);
+        }
+        else
+            job = SHA512_MB_Flush(&mgr);
+
+        if (job == 0) continue;
+        k++;
+
+        SHA512_Init(&H);
+        SHA512_Update(&H, job->prefix, job->prefix_len);
+        SHA512_Update(&H, job->data, job->len);
+        SHA512_Final(md, &H);
+        if (memcmp(md, job->md, SHA512_DIGEST_LENGTH) != 0)
+        {
+            rc++;
+            printf("Multi-buffer SHA512(%d+%d) FAILED!!\n", 
+                job->prefix_len, (int)job->len);
+        }
+    }
+    if (SHA512_MB_Flush(&mgr) != 0)
+    {
+        rc++;
+        printf("Multi-buffer SHA512 flush FAILED!!\n");
+    }
+    return rc;
+}
+
+#ifdef ECP_BASE_CHECK
+#include "base_check.h"
+
+/* Fixed-base multiply against custom_tool's double-and-add vectors */
+int base_check_test()
+{
+    int i, rc = 0;
+    U8 seed[32], pubkey[ed25519_public_key_size], privkey[ed25519_private_key_size];
+    void *blinding;
+
+    mem_fill(seed, 0x5A, sizeof(seed));
+    blinding = ed25519_Blinding_Init(0, seed, sizeof(seed));
+
+    for (i = 0; i < ECP_BASE_CHECK_COUNT; i++)
+    {
+        ed25519_CreateKeyPair(pubkey, privkey, 0, &ecp_BaseCheck_sk[i*32]);
+        if (memcmp(pubkey, &ecp_BaseCheck_pk[i*32], 32) != 0)
+        {
+            rc++;
+            printf("Base point check #%d FAILED!!\n", i);
+        }
+        ed25519_CreateKeyPair(pubkey, privkey, blinding, &ecp_BaseCheck_sk[i*32]);
+        if (memcmp(pubkey, &ecp_BaseCheck_pk[i*32], 32) != 0)
+        {
+            rc++;
+            printf("Base point check #%d (blinded) FAILED!!\n", i);
+        }
+        ed25519_Blinding_Refresh(blinding);
+    }
+    ed25519_Blinding_Finish(blinding);
+    return rc;
+}
+#endif
+
+#if defined(__GNUC__)
+/* 
+    Peak stack of an API call: paint the stack below the caller, make the
+    call from the same frame, then find the deepest byte that changed.
+    Approximate: the paint function's own frame is not counted.
+*/
+#define STACK_PROBE_SIZE    (64*1024)
+#define STACK_PAINT         0x5A
+
+static size_t stack_probe;
+
+static __attribute__((noinline)) void stack_paint(void)
+{
+    volatile U8 buf[STACK_PROBE_SIZE];
+    int i;
+    for (i = 0; i < STACK_PROBE_SIZE; i++) buf[i] = STACK_PAINT;
+    stack_probe = (size_t)buf;
+}
+
+static int stack_used(void)
+{
+    int i = 0;
+    while (i < STACK_PROBE_SIZE && ((volatile U8*)stack_probe)[i] == STACK_PAINT) i++;
+    return STACK_PROBE_SIZE - i;
+}
+
+#define STACK_USE(name, call) \
+    stack_paint(); call; printf("      %-12s %6d bytes\n", name, stack_used())
+
+int footprint_test()
+{
+    U8 secret_key[32], pubkey[32], privkey[64], sig[64], shared[32];
+    U8 ctx_buf[2048];
+    void *ver_context;
+
+    mem_fill(secret_key, 0x42, 32);
+    ecp_TrimSecretKey(secret_key);
+
+    /* first use of the base table (built at first use when ECP_SMALL=2) */
+    ed25519_CreateKeyPair(pubkey, privkey, 0, secret_key);
+
+    printf("\n-- footprint --\n"
+           "    Base table: %d bytes%s, verify context: %d bytes\n"
+           "    Peak stack:\n",
+        (int)(ECP_BASE_ENTRIES*ECP_BASE_TABLES*sizeof(PA_POINT)), 
+        (ECP_SMALL_FOOTPRINT > 1) ? " (built at first use)" : "",
+        (int)(32 + ((ECP_SMALL_FOOTPRINT ? 2 : 8) + 1)*sizeof(PE_POINT) + sizeof(U_WORD)));
+
+    STACK_USE("DH-PubKey", curve25519_dh_CalculatePublicKey(pubkey, secret_key));
+    STACK_USE("DH-Shared", curve25519_dh_CreateSharedKey(shared, pubkey, secret_key));
+    STACK_USE("KeyGen", ed25519_CreateKeyPair(pubkey, privkey, 0, secret_key));
+    STACK_USE("Sign", ed25519_SignMessage(sig, privkey, 0, (const unsigned char*)"abc", 3));
+    STACK_USE("Verify", ed25519_VerifySignature(sig, pubkey, (const unsigned char*)"abc", 3));
+    STACK_USE("Verify_Init", ver_context = ed25519_Verify_Init(ctx_buf, pubkey));
+    STACK_USE("Verify_Check", ed25519_Verify_Check(ver_context, sig, (const unsigned char*)"abc", 3));
+
+    return 0;
+}
+#else
+int footprint_test()
+{
+    return 0;
+}
+#endif
+
+/* eco_Reduce512 and eco_MulAddReduce against the word-at-a-time reduction */
+#define ORDER_BATCH 16
+
+int order_test()
+{
+    int i, k, rc = 0;
+    U_WORD bx[ORDER_BATCH][K_WORDS], by[ORDER_BATCH][K_WORDS];
+    U32 seed = 0x2545F491;
+    U8 b[96];
+    U_WORD T[2*K_WORDS], X[K_WORDS], Y[K_WORDS], A[K_WORDS];
+    U_WORD Z1[K_WORDS], Z2[K_WORDS];
+
+    for (i = 0; i < 1000; i++)
+    {
+        for (k = 0; k < 96; k++)
+        {
+            seed = seed*1103515245 + 12345;
+            b[k] = (U8)(seed >> 24);
+        }
+        /* Extremes: all ones (largest X*Y + A) and zero */
+        if (i == 0) mem_fill(b, 0xFF, sizeof(b));
+        if (i == 1) mem_fill(b, 0, sizeof(b));
+
+        ecp_BytesToWords(T, b);
+        ecp_BytesToWords(T+K_WORDS, b+32);
+        eco_Reduce512(Z1, T);
+        ref_Reduce512(Z2, T);
+        eco_Mod(Z1);
+        eco_Mod(Z2);
+        if (ecp_CmpNE(Z1, Z2))
+        {
+            rc++;
+            printf("eco_Reduce512 #%d FAILED!!\n", i);
+        }
+
+        ecp_BytesToWords(X, b);
+        ecp_BytesToWords(Y, b+32);
+        ecp_BytesToWords(A, b+64);
+        eco_MulAddReduce(Z1, X, Y, A);
+        ecp_Mul(T, X, Y);
+        ref_Reduce512(Z2, T);
+        eco_AddReduce(Z2, Z2, A);
+        eco_Mod(Z1);
+        eco_Mod(Z2);
+        if (ecp_CmpNE(Z1, Z2))
+        {
+            rc++;
+            printf("eco_MulAddReduce #%d FAILED!!\n", i);
+        }
+
+        /* safegcd vs Fermat, and through Montgomery form */
+        if (i == 2) mem_fill(b, 0, 32);         /* 1/0 = 0 */
+        ecp_BytesToWords(X, b);
+        eco_InvModBPO(Z1, X);
+        eco_InvModBPO_Exp(Z2, X);
+        eco_Mod(Z2);
+        if (ecp_CmpNE(Z1, Z2))
+        {
+            rc++;
+            printf("eco_InvModBPO #%d FAILED!!\n", i);
+        }
+        eco_ToMont(A, X);
+        eco_ToMont(Y, Z1);
+        eco_MontMul(Z2, A, Y);
+        eco_FromMont(Z2, Z2);
+        eco_Mod(Z2);
+        ecp_SetValue(A, i == 1 || i == 2 ? 0 : 1);
+        if (ecp_CmpNE(Z2, A))
+        {
+            rc++;
+            printf("X*(1/X) #%d FAILED!!\n", i);
+        }
+    }
+
+    /* Batch against single inversions, with a zero in the list */
+    for (i = 0; i < ORDER_BATCH; i++)
+    {
+        for (k = 0; k < 32; k++)
+        {
+            seed = seed*1103515245 + 12345;
+            b[k] = (U8)(seed >> 24);
+        }
+        if (i == 3) mem_fill(b, 0, 32);
+        ecp_BytesToWords(bx[i], b);
+    }
+    eco_BatchInvModBPO(by[0], bx[0], ORDER_BATCH);
+    for (i = 0; i < ORDER_BATCH; i++)
+    {
+        eco_InvModBPO(Z1, bx[i]);
+        if (ecp_CmpNE(Z1, by[i]))
+        {
+            rc++;
+            printf("eco_BatchInvModBPO #%d FAILED!!\n", i);
+        }
+    }
+    return rc;
+}
+
+/* Contexts from the slab arena: alignment, reuse and results */
+int alloc_test()
+{
+    int i, rc = 0;
+    void *arena, *ctx[8], *p, *blinding, *sign_ctx;
+    U8 seed[32], pubkey[32], privkey[64], sig1[64], sig2[64];
+
+    mem_fill(seed, 0x3C, sizeof(seed));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ed25519_SignMessage(sig1, privkey, 0, (const unsigned char*)"abc", 3);
+
+    if ((arena = ed25519_Arena_Create()) == 0)
+    {
+        printf("ed25519_Arena_Create FAILED!!\n");
+        return 1;
+    }
+    ed25519_SetAllocator(ed25519_Arena_Alloc, ed25519_Arena_Free, arena);
+
+    for (i = 0; i < 8; i++)
+    {
+        ctx[i] = ed25519_Verify_Init(0, pubkey);
+        if (ctx[i] == 0 || ((size_t)ctx[i] & 63) != 0 ||
+            ed25519_Verify_Check(ctx[i], sig1, (const unsigned char*)"abc", 3) != 1)
+        {
+            rc++;
+            printf("Arena verify context #%d FAILED!!\n", i);
+        }
+    }
+
+    /* A freed block is handed out again */
+    ed25519_Verify_Finish(ctx[3]);
+    p = ed25519_Verify_Init(0, pubkey);
+    if (p != ctx[3])
+    {
+        rc++;
+        printf("Arena block reuse FAILED!!\n");
+    }
+    ctx[3] = p;
+
+    blinding = ed25519_Blinding_Init(0, seed, sizeof(seed));
+    sign_ctx = ed25519_Sign_Init(0, privkey, blinding);
+    if (sign_ctx == 0 || ((size_t)sign_ctx & 63) != 0 || ((size_t)blinding & 63) != 0)
+    {
+        rc++;
+        printf("Arena sign context FAILED!!\n");
+    }
+    else
+    {
+        ed25519_Sign_WithCtx(sign_ctx, sig2, (const unsigned char*)"abc", 3);
+        if (memcmp(sig1, sig2, 64) != 0)
+        {
+            rc++;
+            printf("Arena signature FAILED!!\n");
+        }
+    }
+    ed25519_Sign_Finish(sign_ctx);
+    ed25519_Blinding_Finish(blinding);
+
+    for (i = 0; i < 8; i++) ed25519_Verify_Finish(ctx[i]);
+    ed25519_SetAllocator(0, 0, 0);
+    ed25519_Arena_Destroy(arena);
+    return rc;
+}
+
+/* Cached checks agree with ed25519_Verify_Check and never cache failures */
+int cache_test()
+{
+    int i, rc = 0;
+    void *cache, *ctx;
+    U8 seed[32], pubkey[32], privkey[64], sig[64], bad[64];
+    U8 msg[64];
+
+    mem_fill(seed, 0x7E, sizeof(seed));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Verify_Init(0, pubkey);
+    cache = ed25519_VerifyCache_Init(64, seed, sizeof(seed));
+
+    for (i = 0; i < 3*64; i++)
+    {
+        /* 64 distinct messages, each seen three times */
+        mem_fill(msg, i & 63, sizeof(msg));
+        ed25519_SignMessage(sig, privkey, 0, msg, sizeof(msg));
+        if (ed25519_Verify_CheckCached(ctx, cache, sig, msg, sizeof(msg)) != 1)
+        {
+            rc++;
+            printf("Cached check #%d FAILED!!\n", i);
+        }
+
+        /* Same R and S over another message, and a changed S */
+        msg[0] ^= 1;
+        memcpy(bad, sig, 64);
+        bad[40] ^= 1;
+        if (ed25519_Verify_CheckCached(ctx, cache, sig, msg, sizeof(msg)) != 0 ||
+            ed25519_Verify_CheckCached(ctx, cache, bad, msg, sizeof(msg)) != 0 ||
+            ed25519_Verify_CheckCached(ctx, cache, bad, msg, sizeof(msg)) != 0)
+        {
+            rc++;
+            printf("Cached reject #%d FAILED!!\n", i);
+        }
+    }
+
+    ed25519_VerifyCache_Finish(cache);
+    ed25519_Verify_Finish(ctx);
+    return rc;
+}
+
+int pool_test()
+{
+    int i, j, rc = 0, used = 0;
+    void *pool, *pool2, *ctx;
+    U8 seed[32], pool_seed[3][32], pubkey[32], privkey[64], sig[64], sig2[64];
+    U8 msg[64], R[2][16][32];
+
+    mem_fill(seed, 0x3C, sizeof(seed));
+    for (i = 0; i < 3; i++) mem_fill(pool_seed[i], 0x90 + i, 32);
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Sign_Init(0, privkey, 0);
+
+    if (ed25519_SignPool_Init(ctx, 16, pool_seed[0], 31) != 0)
+    {
+        rc++;
+        printf("ed25519_SignPool_Init() short seed FAILED!!\n");
+    }
+
+    /* Caller refills: 16 pooled entries, then inline nonces */
+    pool = ed25519_SignPool_Init(ctx, 16, pool_seed[0], 32);
+    if (ed25519_SignPool_Refill(pool, 100) != 16)
+    {
+        rc++;
+        printf("ed25519_SignPool_Refill() FAILED!!\n");
+    }
+    for (i = 0; i < 32; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        used += ed25519_Sign_FromPool(pool, sig, msg, sizeof(msg));
+        ed25519_Sign_FromPool(pool, sig2, msg, sizeof(msg));
+        if (ed25519_VerifySignature(sig, pubkey, msg, sizeof(msg)) != 1 ||
+            ed25519_VerifySignature(sig2, pubkey, msg, sizeof(msg)) != 1 ||
+            memcmp(sig, sig2, 64) == 0)
+        {
+            rc++;
+            printf("ed25519_Sign_FromPool() #%d FAILED!!\n", i);
+        }
+    }
+    if (used != 8)
+    {
+        rc++;
+        printf("Pooled entries used = %d FAILED!!\n", used);
+    }
+    ed25519_SignPool_Finish(pool);
+
+    /* Two pools never emit the same R, not even from a repeated seed */
+    pool = ed25519_SignPool_Init(ctx, 16, pool_seed[1], 32);
+    pool2 = ed25519_SignPool_Init(ctx, 16, pool_seed[1], 32);
+    for (i = 0; i < 16; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_FromPool(pool, sig, msg, sizeof(msg));
+        memcpy(R[0][i], sig, 32);
+        ed25519_Sign_FromPool(pool2, sig, msg, sizeof(msg));
+        memcpy(R[1][i], sig, 32);
+    }
+    for (i = 0; i < 16; i++)
+        for (j = 0; j < 16; j++)
+            if (memcmp(R[0][i], R[1][j], 32) == 0)
+            {
+                rc++;
+                printf("ed25519_SignPool R reuse #%d/#%d FAILED!!\n", i, j);
+            }
+    ed25519_SignPool_Finish(pool2);
+    ed25519_SignPool_Finish(pool);
+
+    /* Background refill (no-op where threads are not available) */
+    pool = ed25519_SignPool_Init(ctx, 8, pool_seed[2], 32);
+    ed25519_SignPool_Start(pool, 2);
+    for (i = 0; i < 64; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_FromPool(pool, sig, msg, sizeof(msg));
+        if (ed25519_VerifySignature(sig, pubkey, msg, sizeof(msg)) != 1)
+        {
+            rc++;
+            printf("ed25519_Sign_FromPool() threaded #%d FAILED!!\n", i);
+        }
+    }
+    ed25519_SignPool_Finish(pool);
+    ed25519_Sign_Finish(ctx);
+    return rc;
+}
+
+int derive_test()
+{
+    int i, rc = 0;
+    void *ctx, *child, *seq;
+    U8 seed[32], pubkey[32], privkey[64], sig[64], msg[64];
+    static U8 tweaks[40][32], keys[40][32], keys2[40][32];
+
+    mem_fill(seed, 0x5A, sizeof(seed));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Sign_Init(0, privkey, 0);
+
+    /* Child keys sign and verify, batch matches single */
+    for (i = 0; i < 40; i++) mem_fill(tweaks[i], 0xC0 + i, 32);
+    ed25519_DerivePublicKeys(keys[0], pubkey, tweaks[0], 40);
+    for (i = 0; i < 40; i++)
+    {
+        ed25519_DerivePublicKey(keys2[i], pubkey, tweaks[i]);
+        child = ed25519_Sign_Derive(0, ctx, tweaks[i]);
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_WithCtx(child, sig, msg, sizeof(msg));
+        ed25519_Sign_Finish(child);
+        if (memcmp(keys[i], keys2[i], 32) != 0 ||
+            ed25519_VerifySignature(sig, keys[i], msg, sizeof(msg)) != 1 ||
+            ed25519_VerifySignature(sig, pubkey, msg, sizeof(msg)) != 0)
+        {
+            rc++;
+            printf("Derived key #%d FAILED!!\n", i);
+        }
+    }
+
+    /* Sequential keys: pubkey + (i+1)*B, one at a time and in a batch */
+    memset(tweaks, 0, sizeof(tweaks));
+    for (i = 0; i < 40; i++) tweaks[i][0] = (U8)(i + 1);
+    ed25519_DerivePublicKeys(keys[0], pubkey, tweaks[0], 40);
+
+    seq = ed25519_KeySeq_Init(0, pubkey);
+    for (i = 0; i < 40; i++) ed25519_KeySeq_Next(seq, keys2[i], 1);
+    if (memcmp(keys, keys2, sizeof(keys)) != 0)
+    {
+        rc++;
+        printf("ed25519_KeySeq_Next() FAILED!!\n");
+    }
+    ed25519_KeySeq_Init(seq, pubkey);
+    ed25519_KeySeq_Next(seq, keys2[0], 40);
+    if (memcmp(keys, keys2, sizeof(keys)) != 0)
+    {
+        rc++;
+        printf("ed25519_KeySeq_Next() batch FAILED!!\n");
+    }
+    ed25519_KeySeq_Finish(seq);
+    ed25519_Sign_Finish(ctx);
+    return rc;
+}
+
+/* Strict verification: non-canonical S, small-order and mixed-order keys */
+int strict_test()
+{
+    static const U8 order8[32] = {
+        0x26,0xe8,0x95,0x8f,0xc2,0xb2,0x27,0xb0,0x45,0xc3,0xf4,0x89,0xf2,0xef,0x98,0xf0,
+        0xd5,0xdf,0xac,0x05,0xd3,0xc6,0x33,0x39,0xb1,0x38,0x02,0x88,0x6d,0x53,0xfc,0x05 };
+    int i, rc = 0;
+    void *ctx, *ver, *strict;
+    U8 seed[32], pubkey[32], privkey[64], mixed[32], bad[32];
+    U8 msg[64], sig[64];
+    U_WORD s[K_WORDS];
+    Affine_POINT a, t;
+    Ext_POINT P, T;
+    PE_POINT q;
+
+    mem_fill(seed, 0x29, sizeof(seed));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Sign_Init(0, privkey, 0);
+    ver = ed25519_Verify_Init(0, pubkey);
+    strict = ed25519_Verify_InitEx(0, pubkey, ed25519_verify_strict);
+
+    ed25519_Sign_WithCtx(ctx, sig, (const unsigned char*)"abc", 3);
+    if (ed25519_Verify_Check(strict, sig, (const unsigned char*)"abc", 3) != 1)
+    {
+        rc++;
+        printf("Strict check FAILED!!\n");
+    }
+
+    /* S + BPO */
+    ecp_BytesToWords(s, sig+32);
+    ecp_Add(s, s, _w_NxBPO[1]);
+    ecp_WordsToBytes(sig+32, s);
+    if (ed25519_Verify_Check(strict, sig, (const unsigned char*)"abc", 3) != 0)
+    {
+        rc++;
+        printf("Strict reject of S >= l FAILED!!\n");
+    }
+
+    /* Small-order, off-curve and non-canonical keys */
+    for (i = 0; i < 4; i++)
+    {
+        memset(bad, 0, 32);
+        if (i == 0) memcpy(bad, order8, 32);
+        if (i == 1) bad[0] = 1;                         /* neutral point */
+        if (i == 2) bad[0] = 2;                         /* not on the curve */
+        if (i == 3) { mem_fill(bad, 0xFF, 32); bad[0] = 0xEE; bad[31] = 0x7F; } /* p+1 */
+        ed25519_Verify_InitEx(strict, bad, ed25519_verify_strict);
+        if (ed25519_Verify_Check(strict, sig, (const unsigned char*)"abc", 3) != 0)
+        {
+            rc++;
+            printf("Strict key reject #%d FAILED!!\n", i);
+        }
+    }
+
+    /* Mixed-order key A + T8: cofactorless check passes when 8 | h */
+    ed25519_UnpackPoint(&a, pubkey);
+    ed25519_UnpackPoint(&t, order8);
+    ecp_Copy(P.x, a.x); ecp_Copy(P.y, a.y); ecp_SetValue(P.z, 1); ecp_MulMod(P.t, a.x, a.y);
+    ecp_Copy(T.x, t.x); ecp_Copy(T.y, t.y); ecp_SetValue(T.z, 1); ecp_MulMod(T.t, t.x, t.y);
+    edp_ExtPoint2PE(&q, &T);
+    edp_AddPoint(&P, &P, &q);
+    ecp_Inverse(P.z, P.z);
+    ecp_MulMod(a.x, P.x, P.z);
+    ecp_MulMod(a.y, P.y, P.z);
+    ed25519_PackPoint(mixed, a.y, a.x[0]);
+
+    memcpy(((EDP_SIGN_CTX*)ctx)->pk, mixed, 32);
+    ed25519_Verify_Init(ver, mixed);
+    ed25519_Verify_InitEx(strict, mixed, ed25519_verify_strict);
+    for (i = 0; i < 256; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_WithCtx(ctx, sig, msg, sizeof(msg));
+        if (ed25519_Verify_Check(ver, sig, msg, sizeof(msg)) == 1) break;
+    }
+    if (i == 256 || ed25519_Verify_Check(strict, sig, msg, sizeof(msg)) != 0)
+    {
+        rc++;
+        printf("Strict reject of mixed-order key FAILED!!\n");
+    }
+
+    ed25519_Verify_Finish(strict);
+    ed25519_Verify_Finish(ver);
+    ed25519_Sign_Finish(ctx);
+    return rc;
+}
+
+/* Low-latency mode gives the same keys and signatures */
+int lowlat_test()
+{
+    int i, rc = 0;
+    void *ctx, *ver;
+    U8 seed[32], pubkey[32], privkey[64], pub2[32], priv2[64];
+    U8 msg[64], sig[64];
+    static U8 sigs[32][64];
+
+    mem_fill(seed, 0x61, sizeof(seed));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Sign_Init(0, privkey, 0);
+    ver = ed25519_Verify_Init(0, pubkey);
+    for (i = 0; i < 32; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_WithCtx(ctx, sigs[i], msg, sizeof(msg));
+    }
+
+    if (ed25519_LowLatency_Start(2) == 0)
+    {
+        printf("Low-latency mode not available (no free core), skipped.\n");
+        ed25519_Verify_Finish(ver);
+        ed25519_Sign_Finish(ctx);
+        return rc;
+    }
+
+    ed25519_CreateKeyPair(pub2, priv2, 0, seed);
+    if (memcmp(pubkey, pub2, 32) != 0)
+    {
+        rc++;
+        printf("Low-latency ed25519_CreateKeyPair() FAILED!!\n");
+    }
+    for (i = 0; i < 32; i++)
+    {
+        mem_fill(msg, i, sizeof(msg));
+        ed25519_Sign_WithCtx(ctx, sig, msg, sizeof(msg));
+        if (memcmp(sig, sigs[i], 64) != 0 ||
+            ed25519_Verify_Check(ver, sig, msg, sizeof(msg)) != 1)
+        {
+            rc++;
+            printf("Low-latency sign/verify #%d FAILED!!\n", i);
+        }
+        sig[i] ^= 1;
+        if (ed25519_Verify_Check(ver, sig, msg, sizeof(msg)) != 0)
+        {
+            rc++;
+            printf("Low-latency reject #%d FAILED!!\n", i);
+        }
+    }
+    ed25519_LowLatency_Stop();
+
+    ed25519_Verify_Finish(ver);
+    ed25519_Sign_Finish(ctx);
+    return rc;
+}
+
+#if ECP_COUNT_OPS
+/* Field operations of one point operation against its "Cost:" comment */
+static int count_check(const char *name, int m, int s, int add)
+{
+    ECP_OP_COUNTS c;
+    ecp_OpCounts_Snapshot(&c);
+    ecp_OpCounts_Reset();
+    printf("  %-20s %lldM + %lldS + %lldadd\n", name, c.n[ECP_OP_MUL_REDUCE], 
+        c.n[ECP_OP_SQR_REDUCE], c.n[ECP_OP_ADD_REDUCE] + c.n[ECP_OP_SUB_REDUCE]);
+    if (c.n[ECP_OP_MUL_REDUCE] != (U64)m || c.n[ECP_OP_SQR_REDUCE] != (U64)s ||
+        c.n[ECP_OP_ADD_REDUCE] + c.n[ECP_OP_SUB_REDUCE] != (U64)add)
+    {
+        printf("%s: expected %dM + %dS + %dadd FAILED!!\n", name, m, s, add);
+        return 1;
+    }
+    return 0;
+}
+
+/* Print and reset the counters of this thread */
+static void count_print(const char *name)
+{
+    ECP_OP_COUNTS c;
+    int i, n = 0;
+    ecp_OpCounts_Snapshot(&c);
+    ecp_OpCounts_Reset();
+    printf("  %s:", name);
+    for (i = 0; i < ECP_OP_COUNT; i++)
+    {
+        if (c.n[i] == 0) continue;
+        printf("%s%s=%lld", (n++ % 4) ? ", " : "\n    ", ecp_OpName(i), c.n[i]);
+    }
+    printf("\n");
+}
+
+int count_test()
+{
+    int i, rc = 0;
+    void *ctx, *ver, *strict, *pool, *seq;
+    U8 seed[32], pubkey[32], privkey[64], sig[64], msg[64], out[2*32];
+    U8 dh_sk[32], dh_pk[32];
+    U8 sigs[16][64];
+    U8 *sig_ptrs[16];
+    const U8 *msgs[16];
+    size_t sizes[16];
+    ECP_OP_COUNTS c;
+    Ext_POINT P;
+    PE_POINT q;
+
+    printf("\n-- operation counts (ECP_COUNT_OPS) ----------------------------\n");
+    mem_fill(seed, 0x3C, sizeof(seed));
+    mem_fill(msg, 0x71, sizeof(msg));
+    mem_fill(dh_sk, 0x5E, sizeof(dh_sk));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+    ctx = ed25519_Sign_Init(0, privkey, 0);
+    ed25519_SignMessage(sig, privkey, 0, msg, sizeof(msg));
+    ver = ed25519_Verify_Init(0, pubkey);
+    strict = ed25519_Verify_InitEx(0, pubkey, ed25519_verify_strict);
+    pool = ed25519_SignPool_Init(ctx, 4, seed, sizeof(seed));
+    ed25519_SignPool_Refill(pool, 4);
+    seq = ed25519_KeySeq_Init(0, pubkey);
+    curve25519_dh_CalculatePublicKey(dh_pk, dh_sk);
+    for (i = 0; i < 16; i++)
+    {
+        sig_ptrs[i] = sigs[i];
+        msgs[i] = msg;
+        sizes[i] = sizeof(msg);
+    }
+
+    /* P = 2B */
+    memset(&P, 0, sizeof(P));
+    ecp_SetValue(P.y, 1);
+    ecp_SetValue(P.z, 1);
+    edp_AddBasePoint(&P);
+    edp_ExtPoint2PE(&q, &P);
+    edp_DoublePoint(&P);
+
+    ecp_OpCounts_Reset();
+    edp_DoublePoint(&P);
+    rc += count_check("edp_DoublePoint", 4, 4, 7);
+    edp_AddPoint(&P, &P, &q);
+    rc += count_check("edp_AddPoint", 8, 0, 6);
+    edp_SubPoint(&P, &P, &q);
+    rc += count_check("edp_SubPoint", 8, 0, 6);
+    edp_AddAffinePoint(&P, &_w_base_multiples[1]);
+    rc += count_check("edp_AddAffinePoint", 7, 0, 7);
+    edp_SubAffinePoint(&P, &_w_base_multiples[1]);
+    rc += count_check("edp_SubAffinePoint", 7, 0, 7);
+    edp_AddBasePoint(&P);
+    rc += count_check("edp_AddBasePoint", 7, 0, 7);
+
+    /* A check is one double multiplication and one inversion */
+    ed25519_Verify_Check(ver, sig, msg, sizeof(msg));
+    ecp_OpCounts_Snapshot(&c);
+    if (c.n[EDP_OP_POLY_MULT] != 1 || c.n[ECP_OP_INVERSE] != 1)
+    {
+        rc++;
+        printf("ed25519_Verify_Check() op count FAILED!!\n");
+    }
+
+    ecp_OpCounts_Reset();
+    curve25519_dh_CalculatePublicKey(out, dh_sk);
+    count_print("curve25519_dh_CalculatePublicKey");
+    curve25519_dh_CalculatePublicKey_fast(out, dh_sk);
+    count_print("curve25519_dh_CalculatePublicKey_fast");
+    curve25519_dh_CreateSharedKey(out, dh_pk, dh_sk);
+    count_print("curve25519_dh_CreateSharedKey");
+    ed25519_CreateKeyPair(out, privkey, 0, seed);
+    count_print("ed25519_CreateKeyPair");
+    ed25519_SignMessage(sigs[0], privkey, 0, msg, sizeof(msg));
+    count_print("ed25519_SignMessage");
+    ed25519_Sign_Init(ctx, privkey, 0);
+    count_print("ed25519_Sign_Init");
+    ed25519_Sign_WithCtx(ctx, sigs[0], msg, sizeof(msg));
+    count_print("ed25519_Sign_WithCtx");
+    ed25519_SignBatch(ctx, sig_ptrs, msgs, sizes, 16);
+    count_print("ed25519_SignBatch (16)");
+    ed25519_Sign_FromPool(pool, sigs[0], msg, sizeof(msg));
+    count_print("ed25519_Sign_FromPool");
+    ed25519_DerivePublicKey(out, pubkey, seed);
+    count_print("ed25519_DerivePublicKey");
+    ed25519_KeySeq_Next(seq, out, 2);
+    count_print("ed25519_KeySeq_Next (2)");
+    ed25519_VerifySignature(sig, pubkey, msg, sizeof(msg));
+    count_print("ed25519_VerifySignature");
+    ed25519_Verify_Init(ver, pubkey);
+    count_print("ed25519_Verify_Init");
+    ed25519_Verify_InitEx(strict, pubkey, ed25519_verify_strict);
+    count_print("ed25519_Verify_InitEx (strict)");
+    ed25519_Verify_Check(ver, sig, msg, sizeof(msg));
+    count_print("ed25519_Verify_Check");
+    ed25519_Verify_Check(strict, sig, msg, sizeof(msg));
+    count_print("ed25519_Verify_Check (strict)");
+    ed25519_Verify_CheckBatch(ver, 16, (const U8 * const *)sig_ptrs, msgs, sizes, 0);
+    count_print("ed25519_Verify_CheckBatch (16)");
+
+    ed25519_KeySeq_Finish(seq);
+    ed25519_SignPool_Finish(pool);
+    ed25519_Verify_Finish(strict);
+    ed25519_Verify_Finish(ver);
+    ed25519_Sign_Finish(ctx);
+    return rc;
+}
+#endif
+
+#if ECP_LATENCY
+#define LATENCY_CALLS   20
+
+/* Median of a histogram: start of the bucket holding the middle call */
+static unsigned long long latency_median(const ed25519_latency *h)
+{
+    unsigned long long n = 0;
+    int i;
+    for (i = 0; i < ed25519_latency_buckets; i++)
+    {
+        n += h->bucket[i];
+        if (2*n >= h->count) return ed25519_Latency_BucketStart(i);
+    }
+    return 0;
+}
+
+int latency_test()
+{
+    int i, n, rc = 0;
+    unsigned long long sum;
+    U8 seed[32], pubkey[32], privkey[64], sig[64], msg[64], out[32];
+    ed25519_latency *hist;
+
+    printf("\n-- latency histograms (ECP_LATENCY) ----------------------------\n");
+    hist = (ed25519_latency*)malloc(EDP_API_COUNT*sizeof(ed25519_latency));
+    if (hist == 0) return 1;
+
+    for (i = 1; i < ed25519_latency_buckets; i++)
+    {
+        if (ed25519_Latency_BucketStart(i) <= ed25519_Latency_BucketStart(i-1))
+        {
+            rc++;
+            printf("ed25519_Latency_BucketStart(%d) FAILED!!\n", i);
+            break;
+        }
+    }
+
+    mem_fill(seed, 0x29, sizeof(seed));
+    mem_fill(msg, 0x47, sizeof(msg));
+    ed25519_CreateKeyPair(pubkey, privkey, 0, seed);
+
+    ed25519_Latency_Reset();
+    for (i = 0; i < LATENCY_CALLS; i++)
+    {
+        ed25519_SignMessage(sig, privkey, 0, msg, sizeof(msg));
+        if (!ed25519_VerifySignature(sig, pubkey, msg, sizeof(msg))) rc++;
+        curve25519_dh_CalculatePublicKey_fast(out, seed);
+    }
+
+    n = ed25519_Latency_Snapshot(hist, EDP_API_COUNT);
+    if (n != EDP_API_COUNT)
+    {
+        rc++;
+        printf("ed25519_Latency_Snapshot() = %d FAILED!!\n", n);
+    }
+
+    /* Only the calls made here are recorded, none of the nested ones */
+    if (hist[EDP_API_SignMessage].count != LATENCY_CALLS ||
+        hist[EDP_API_Sign_Init].count != 0 ||
+        hist[EDP_API_Sign_WithCtx].count != 0 ||
+        hist[EDP_API_VerifySignature].count != LATENCY_CALLS ||
+        hist[EDP_API_Verify_Init].count != 0 ||
+        hist[EDP_API_Verify_InitEx].count != 0 ||
+        hist[EDP_API_Verify_Check].count != 0 ||
+        hist[EDP_API_dh_CalculatePublicKey_fast].count != LATENCY_CALLS ||
+        hist[EDP_API_CreateKeyPair].count != 0)
+    {
+        rc++;
+        printf("Latency call counts FAILED!!\n");
+    }
+
+    for (n = 0; n < EDP_API_COUNT; n++)
+    {
+        if (hist[n].count == 0) continue;
+        for (sum = 0, i = 0; i < ed25519_latency_buckets; i++) sum += hist[n].bucket[i];
+        if (sum != hist[n].count || hist[n].total_ns == 0)
+        {
+            rc++;
+            printf("%s: histogram FAILED!!\n", hist[n].name);
+        }
+        printf("  %-38s calls: %4lld  median: %8lld ns  mean: %8lld ns\n", hist[n].name,
+            hist[n].count, latency_median(&hist[n]), hist[n].total_ns/hist[n].count);
+    }
+
+    /* One more SignMessage call leaves the Sign_Init count unchanged */
+    sum = hist[EDP_API_Sign_Init].count;
+    ed25519_SignMessage(sig, privkey, 0, msg, sizeof(msg));
+    ed25519_Latency_Snapshot(hist, EDP_API_COUNT);
+    if (hist[EDP_API_Sign_Init].count != sum ||
+        hist[EDP_API_SignMessage].count != LATENCY_CALLS + 1)
+    {
+        rc++;
+        printf("SignMessage -> Sign_Init call count FAILED!!\n");
+    }
+
+    ed25519_Latency_Reset();
+    ed25519_Latency_Snapshot(hist, EDP_API_COUNT);
+    if (hist[EDP_API_SignMessage].count != 0)
+    {
+        rc++;
+        printf("ed25519_Latency_Reset() FAILED!!\n");
+    }
+
+    free(hist);
+    return rc;
+}
+#endif
+
 int curve25519_SelfTest(int level);
 int ed25519_selftest();
 
@@ -478,6 +2013,10 @@ int main(int argc, char**argv)
 {
     int rc = 0;
 
+    /* 'f': footprint report only (make footprint) */
+    if (argc > 1 && argv[1][0] == 'f')
+        return footprint_test();
+
 #ifdef ECP_SELF_TEST
     if (curve25519_SelfTest(0))
     {
@@ -495,6 +2034,26 @@ int main(int argc, char**argv)
 
     rc += signature_test(sk1, pk1, msg1, sizeof(msg1), msg1_sig);
 
+    rc += hash_test();
+    rc += hash_mb_test();
+    rc += order_test();
+    rc += alloc_test();
+    rc += cache_test();
+    rc += pool_test();
+    rc += derive_test();
+    rc += lowlat_test();
+    rc += strict_test();
+#if ECP_COUNT_OPS
+    rc += count_test();
+#endif
+#if ECP_LATENCY
+    rc += latency_test();
+#endif
+#ifdef ECP_BASE_CHECK
+    rc += base_check_test();
+#endif
+    rc += footprint_test();
+
     speed_test(1000);
 
     return rc;